@@ -0,0 +1,107 @@
+/**
+ * @file AllocationBench.cxx
+ * @brief Regression benchmark counting the heap allocations done by the Number arithmetic of a pivot
+ * @version 0.1
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "../Representation/Values/Number.hxx"
+
+// Every allocation of the process goes through here, so we can count them
+static unsigned long long allocationCount = 0;
+
+void * operator new(std::size_t size) {
+    ++allocationCount;
+    void * pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void * pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+/**
+ * Same arithmetic as Table::calculateCjZj followed by Table::executeIterationChange,
+ * over a synthetic tableau with M values in the costs
+ */
+static void pivot(std::vector< std::vector<Value::Number> > &table,
+                  std::vector<Value::Number> &costs,
+                  std::vector<Value::Number> &baseCosts,
+                  int pivotLine, int pivotColumn) {
+    int numRes = table.size() - 1;
+    int numVar = table[0].size() - 2;
+
+    Value::Number current;
+    for (int j = 0; j < numVar; ++j) {
+        current = Value::Number(0,0);
+        for (int i = 0; i < numRes; ++i) {
+            current += table[i][j] * baseCosts[i];
+        }
+        table[numRes][j] = costs[j] - current;
+    }
+
+    Value::Number pivotElement = table[pivotLine][pivotColumn];
+    for (int j = 0; j <= numVar; ++j) {
+        table[pivotLine][j] = table[pivotLine][j]/pivotElement;
+    }
+    for (int i = 0; i < numRes; ++i) {
+        if (i == pivotLine) continue;
+        Value::Number pivotColumnEqualizer = table[i][pivotColumn];
+        for (int j = 0; j <= numVar; ++j) {
+            table[i][j] = table[i][j] - table[pivotLine][j]*pivotColumnEqualizer;
+        }
+    }
+    baseCosts[pivotLine] = costs[pivotColumn];
+}
+
+int main(int argc, char ** argv) {
+    int numRes = (argc > 1) ? std::atoi(argv[1]) : 200;
+    int numVar = (argc > 2) ? std::atoi(argv[2]) : 500;
+    int pivots = (argc > 3) ? std::atoi(argv[3]) : 50;
+
+    std::vector< std::vector<Value::Number> > table(numRes+1, std::vector<Value::Number>(numVar+2));
+    std::vector<Value::Number> costs(numVar);
+    std::vector<Value::Number> baseCosts(numRes);
+
+    for (int i = 0; i < numRes; ++i) {
+        for (int j = 0; j <= numVar; ++j) {
+            table[i][j] = Value::Number(1 + (i*7 + j*13) % 17);
+        }
+        baseCosts[i] = Value::Number(0, -1);
+    }
+    for (int j = 0; j < numVar; ++j) {
+        costs[j] = Value::Number(1 + j % 5, (j % 3 == 0) ? -1 : 0);
+    }
+
+    unsigned long long before = allocationCount;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < pivots; ++p) {
+        pivot(table, costs, baseCosts, p % numRes, (p*31) % numVar);
+    }
+    auto end = std::chrono::steady_clock::now();
+    unsigned long long allocations = allocationCount - before;
+
+    double nsPerPivot = std::chrono::duration<double, std::nano>(end - start).count() / pivots;
+    std::cout   << "{\"benchmark\": \"number_allocations\", \"rows\": " << numRes
+                << ", \"columns\": " << numVar
+                << ", \"pivots\": " << pivots
+                << ", \"ns_per_pivot\": " << nsPerPivot
+                << ", \"allocations_per_pivot\": " << static_cast<double>(allocations) / pivots
+                << "}" << std::endl;
+
+    // Any allocation here is a regression
+    return (allocations == 0) ? 0 : 1;
+}
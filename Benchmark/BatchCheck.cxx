@@ -0,0 +1,79 @@
+/**
+ * @file BatchCheck.cxx
+ * @brief Checks the batch lines are valid JSON whatever the numbers are, and that a long batch
+ * doesn't keep the memory of the models it already solved
+ * @version 0.1
+ *
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Bench.hxx"
+#include "../Solver/Batch.hxx"
+
+namespace {
+
+    bool notFinite() {
+        Solver::batchResult result{"model.lp", Solver::solveResult(), 0.5};
+        result.result.solution = Solver::DONE;
+        result.result.objective = std::numeric_limits<double>::infinity();
+        result.result.values = {NAN, 1, -std::numeric_limits<double>::infinity()};
+        std::string line = Solver::Batch::to_json(result, true);
+        if (line.find("\"objective\": null") == std::string::npos ||
+            line.find("\"values\": [null, 1, null]") == std::string::npos ||
+            line.find("inf") != std::string::npos || line.find("nan") != std::string::npos) {
+            std::cout << "batch_not_finite: " << line << std::endl;
+            return false;
+        }
+        std::cout << "batch_not_finite: ok" << std::endl;
+        return true;
+    }
+
+    /**
+     * The same model file many times over: past the first ones the peak memory shouldn't move,
+     * each job frees everything it read and solved
+     */
+    bool longBatch() {
+        const int WARM_UP = 50;
+        const int JOBS = 800;
+        const long GROWTH_KB = 4096;
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "solver_batch_check.lp";
+        {
+            std::ofstream file(path);
+            file << Bench::randomLp(40, 50);
+        }
+
+        Solver::Batch batch(1);
+        std::ostringstream output;
+        batch.run(std::vector<std::string>(WARM_UP, path.string()), output);
+        long settled = Bench::peakRssKb();
+        int failed = batch.run(std::vector<std::string>(JOBS, path.string()), output);
+        long growth = Bench::peakRssKb() - settled;
+        std::filesystem::remove(path);
+
+        if (failed > 0 || output.str().find("\"status\": \"ERROR\"") != std::string::npos) {
+            std::cout << "batch_same_model: " << failed << " jobs failed" << std::endl;
+            return false;
+        }
+        if (growth > GROWTH_KB) {
+            std::cout << "batch_same_model: " << growth << " kB more after " << JOBS << " jobs" << std::endl;
+            return false;
+        }
+        std::cout << "batch_same_model: ok" << std::endl;
+        return true;
+    }
+
+};
+
+int main() {
+    bool passed = notFinite();
+    passed = longBatch() && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file Bench.hxx
+ * @brief File implemented to define what the benchmarks share: timing, peak memory and the JSON lines
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace Bench {
+
+    typedef std::chrono::steady_clock clock;
+
+    inline double nanoseconds(clock::time_point begin, clock::time_point end) {
+        return std::chrono::duration<double, std::nano>(end - begin).count();
+    }
+
+    // Peak resident memory of the process so far, 0 where it can't be read
+    inline long peakRssKb() {
+#ifdef _WIN32
+        return 0;
+#else
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+#endif
+    }
+
+    // Deterministic numbers for the generated models, the same ones on every run and machine
+    class Random {
+
+        public:
+
+            Random(std::uint64_t seed) : state(seed*2654435761u + 1) {}
+
+            std::uint64_t next() {
+                // xorshift64*
+                state ^= state >> 12;
+                state ^= state << 25;
+                state ^= state >> 27;
+                return state * 2685821657736338717ull;
+            }
+
+            // In [low, high]
+            int between(int low, int high) {
+                return low + static_cast<int>(next() % static_cast<std::uint64_t>(high - low + 1));
+            }
+
+        private:
+
+            std::uint64_t state;
+    };
+
+    // Max c*x over a*x <= b as an LP file, a >= 0 and b > 0 so x = 0 is feasible for any b >= 0
+    inline std::string randomLp(int rows, int columns) {
+        Random random(rows*31 + columns);
+        std::string text = "Maximize\n obj:";
+        for (int j = 0; j < columns; ++j) {
+            text += " + " + std::to_string(random.between(1, 20)) + " x" + std::to_string(j+1);
+        }
+        text += "\nSubject To\n";
+        for (int i = 0; i < rows; ++i) {
+            text += " r" + std::to_string(i+1) + ":";
+            for (int j = 0; j < columns; ++j) {
+                text += " + " + std::to_string(random.between(1, 9)) + " x" + std::to_string(j+1);
+            }
+            text += " <= " + std::to_string(random.between(10, 100)*columns) + "\n";
+        }
+        return text + "End\n";
+    }
+
+    /**
+     * One JSON object per line, the keys in the order they were added:
+     *  {"benchmark": "calculate_theta", "rows": 200, ...}
+     */
+    class Line {
+
+        public:
+
+            Line(const std::string &name) {
+                text << "{\"benchmark\": \"" << name << "\"";
+            }
+
+            Line& add(const std::string &key, double value) {
+                text << ", \"" << key << "\": " << value;
+                return *this;
+            }
+
+            Line& add(const std::string &key, const std::string &value) {
+                text << ", \"" << key << "\": \"" << value << "\"";
+                return *this;
+            }
+
+            std::string to_string() const { return text.str() + "}"; }
+
+        private:
+
+            std::ostringstream text;
+    };
+
+    /**
+     * Runs the benchmark on its own process, so the peak memory it shows is only its own
+     * The benchmark prints its lines itself, false if it failed (or the process died)
+     */
+    template <typename Function>
+    bool isolated(Function benchmark) {
+#ifdef _WIN32
+        return benchmark();
+#else
+        std::cout.flush();
+        pid_t child = fork();
+        if (child < 0) {
+            return benchmark();
+        } else if (child == 0) {
+            bool passed = benchmark();
+            std::cout.flush();
+            _exit(passed ? 0 : 1);
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+    }
+
+};
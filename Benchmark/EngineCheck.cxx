@@ -0,0 +1,251 @@
+/**
+ * @file EngineCheck.cxx
+ * @brief Solves the same models with every engine, the ones with = restrictions mostly, and fails
+ * when they don't agree, an optimum breaks an = restriction or the memory grows with the solves
+ * @version 0.1
+ *
+ */
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hxx"
+#include "../Representation/Readers/Reader.hxx"
+#include "../Solver/Solve.hxx"
+
+namespace {
+
+    const double TOLERANCE = 1e-6;
+
+    // Kept apart from the builder, so an optimum can be checked against it afterwards
+    struct model {
+        std::string name;
+        LinearSystems::objType action = LinearSystems::MAX;
+        std::vector<double> costs;
+        std::vector<double> upper;  // Empty for no upper bounds
+        std::vector< std::vector<double> > lines;
+        std::vector<LinearSystems::symbolEnum> symbols;
+        std::vector<double> rightSides;
+        bool feasible = true;
+        double expected = NAN;      // Optimum known beforehand, NAN if it isn't
+    };
+
+    void build(const model &input, Readers::ModelBuilder &builder) {
+        builder.setAction(input.action);
+        for (size_t j = 0; j < input.costs.size(); ++j) {
+            int variable = builder.getVariable("x" + std::to_string(j+1));
+            builder.addObjective(variable, input.costs[j]);
+            if (!input.upper.empty()) {
+                builder.setUpperBound(variable, input.upper[j]);
+            }
+        }
+        for (size_t i = 0; i < input.lines.size(); ++i) {
+            int restriction = builder.addRestriction("r" + std::to_string(i+1), input.symbols[i]);
+            for (size_t j = 0; j < input.lines[i].size(); ++j) {
+                if (input.lines[i][j] != 0) {
+                    builder.addCoefficient(restriction, j, input.lines[i][j]);
+                }
+            }
+            builder.setRightSide(restriction, input.rightSides[i]);
+        }
+    }
+
+    // max x1 + 2 x2, x1 + x2 <= 10, x1 - x2 = 1: 14.5 at (5.5, 4.5), 20 if the = line is ignored
+    model smallEqual(bool redundant) {
+        model result;
+        result.name = redundant ? "equal_redundant" : "equal_small";
+        result.costs = {1, 2};
+        result.lines = {{1, 1}, {1, -1}};
+        result.symbols = {LinearSystems::LOWER_EQUAL, LinearSystems::EQUAL};
+        result.rightSides = {10, 1};
+        if (redundant) {
+            result.lines.push_back({2, -2});
+            result.symbols.push_back(LinearSystems::EQUAL);
+            result.rightSides.push_back(2);
+        }
+        result.expected = 14.5;
+        return result;
+    }
+
+    // x1 + x2 = 3 and x1 + x2 = 4
+    model conflictingEqual() {
+        model result;
+        result.name = "equal_conflicting";
+        result.costs = {1, 1};
+        result.lines = {{1, 1}, {1, 1}};
+        result.symbols = {LinearSystems::EQUAL, LinearSystems::EQUAL};
+        result.rightSides = {3, 4};
+        result.feasible = false;
+        return result;
+    }
+
+    /**
+     * <=, >= and = lines around a point that meets all of them, so it's feasible, and an upper
+     * bound on every variable, so it's bounded. The last = line is twice an earlier one
+     */
+    model randomEqual(int rows, int columns, int seed) {
+        Bench::Random random(seed);
+        model result;
+        result.name = "equal_random_" + std::to_string(seed);
+        result.action = seed % 2 == 0 ? LinearSystems::MAX : LinearSystems::MIN;
+        std::vector<double> point(columns);
+        for (int j = 0; j < columns; ++j) {
+            result.costs.push_back(random.between(-5, 10));
+            result.upper.push_back(random.between(5, 20));
+            point[j] = random.between(0, 4);
+        }
+        for (int i = 0; i < rows; ++i) {
+            std::vector<double> line(columns, 0);
+            double activity = 0;
+            for (int j = 0; j < columns; ++j) {
+                if (random.between(0, 2) != 0) {
+                    line[j] = random.between(-3, 6);
+                    activity += line[j]*point[j];
+                }
+            }
+            int kind = random.between(0, 2);
+            result.lines.push_back(line);
+            if (kind == 0) {
+                result.symbols.push_back(LinearSystems::EQUAL);
+                result.rightSides.push_back(activity);
+            } else if (kind == 1) {
+                result.symbols.push_back(LinearSystems::LOWER_EQUAL);
+                result.rightSides.push_back(activity + random.between(0, 10));
+            } else {
+                result.symbols.push_back(LinearSystems::HIGHER_EQUAL);
+                result.rightSides.push_back(activity - random.between(0, 10));
+            }
+        }
+        std::vector<double> twice = result.lines[0];
+        for (double &value : twice) {
+            value *= 2;
+        }
+        double activity = 0;
+        for (int j = 0; j < columns; ++j) {
+            activity += twice[j]*point[j];
+        }
+        result.lines.push_back(twice);
+        result.symbols.push_back(LinearSystems::EQUAL);
+        result.rightSides.push_back(activity);
+        return result;
+    }
+
+    const char * engineName(Solver::engineType engine) {
+        return engine == Solver::REVISED ? "revised" : engine == Solver::TWO_PHASE ? "two-phase" : "tableau";
+    }
+
+    // Empty if the optimum meets every = line of the model
+    std::string brokenEqual(const model &input, const Solver::solveResult &result) {
+        for (size_t i = 0; i < input.lines.size(); ++i) {
+            if (input.symbols[i] != LinearSystems::EQUAL) {
+                continue;
+            }
+            double activity = 0;
+            for (size_t j = 0; j < input.lines[i].size() && j < result.values.size(); ++j) {
+                activity += input.lines[i][j]*result.values[j];
+            }
+            if (std::fabs(activity - input.rightSides[i]) > TOLERANCE*(1 + std::fabs(input.rightSides[i]))) {
+                return "r" + std::to_string(i+1) + " is " + std::to_string(activity) + ", not " +
+                       std::to_string(input.rightSides[i]);
+            }
+        }
+        return "";
+    }
+
+    bool check(const model &input) {
+        bool passed = true;
+        bool first = true;
+        double objective = 0;
+        for (Solver::engineType engine : {Solver::TABLEAU, Solver::TWO_PHASE, Solver::REVISED}) {
+            Readers::ModelBuilder builder;
+            build(input, builder);
+            Solver::solveOptions options;
+            options.engine = engine;
+            Solver::solveResult result = Solver::solve(builder, options);
+
+            std::string problem;
+            if (!result.error.empty()) {
+                problem = result.error;
+            } else if (result.isOptimal() != input.feasible) {
+                problem = "ended with " + Solver::to_string(result.solution);
+            } else if (result.isOptimal()) {
+                problem = brokenEqual(input, result);
+                if (problem.empty() && !std::isnan(input.expected) &&
+                    std::fabs(result.objective - input.expected) > TOLERANCE*(1 + std::fabs(input.expected))) {
+                    problem = "objective " + std::to_string(result.objective) + ", not " +
+                              std::to_string(input.expected);
+                }
+                if (problem.empty() && !first &&
+                    std::fabs(result.objective - objective) > TOLERANCE*(1 + std::fabs(objective))) {
+                    problem = "objective " + std::to_string(result.objective) + ", tableau has " +
+                              std::to_string(objective);
+                }
+                if (first) {
+                    objective = result.objective;
+                    first = false;
+                }
+            }
+            if (!problem.empty()) {
+                std::cout << input.name << " (" << engineName(engine) << "): " << problem << std::endl;
+                passed = false;
+            }
+        }
+        if (passed) {
+            std::cout << input.name << ": ok" << std::endl;
+        }
+        return passed;
+    }
+
+    /**
+     * The library API builds and frees a System on every solve, past the first solves the peak
+     * memory shouldn't move however many an embedding program makes
+     */
+    bool sameModelManyTimes() {
+        const int WARM_UP = 50;
+        const int SOLVES = 600;
+        const long GROWTH_KB = 4096;
+        model input = randomEqual(30, 40, 7);
+        bool passed = true;
+        for (Solver::engineType engine : {Solver::TABLEAU, Solver::TWO_PHASE, Solver::REVISED}) {
+            Solver::solveOptions options;
+            options.engine = engine;
+            options.presolve = engine != Solver::TWO_PHASE;
+            long settled = 0;
+            for (int k = 0; k < SOLVES; ++k) {
+                Readers::ModelBuilder builder;
+                build(input, builder);
+                Solver::solve(builder, options);
+                if (k == WARM_UP) {
+                    settled = Bench::peakRssKb();
+                }
+            }
+            long growth = Bench::peakRssKb() - settled;
+            if (growth > GROWTH_KB) {
+                std::cout << "library_same_model (" << engineName(engine) << "): " << growth << " kB more after "
+                          << SOLVES - WARM_UP << " solves" << std::endl;
+                passed = false;
+            }
+        }
+        if (passed) {
+            std::cout << "library_same_model: ok" << std::endl;
+        }
+        return passed;
+    }
+
+};
+
+int main() {
+    std::vector<model> models = {smallEqual(false), smallEqual(true), conflictingEqual()};
+    for (int seed = 1; seed <= 20; ++seed) {
+        models.push_back(randomEqual(4 + seed % 7, 5 + seed % 5, seed));
+    }
+
+    bool passed = true;
+    for (const model &input : models) {
+        passed = check(input) && passed;
+    }
+    passed = sameModelManyTimes() && passed;
+    return passed ? 0 : 1;
+}
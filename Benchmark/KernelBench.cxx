@@ -0,0 +1,161 @@
+/**
+ * @file KernelBench.cxx
+ * @brief Micro benchmarks of the pivot loop: the Number arithmetic and each step of the table
+ * @version 0.1
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "Bench.hxx"
+#include "../Representation/Values/Number.hxx"
+#include "../Representation/Readers/Reader.hxx"
+#include "../Solver/Table.hxx"
+
+/**
+ * Maximizes c*x over dense a*x <= b, a > 0 so it's bounded and x = 0 is the starting base
+ */
+static LinearSystems::System * synthetic(int rows, int columns, int seed) {
+    Bench::Random random(seed);
+    Readers::ModelBuilder model;
+    model.setAction(LinearSystems::MAX);
+    for (int j = 0; j < columns; ++j) {
+        model.addObjective(model.getVariable("x" + std::to_string(j+1)), random.between(1, 20));
+    }
+    for (int i = 0; i < rows; ++i) {
+        int restriction = model.addRestriction("r" + std::to_string(i+1), LinearSystems::LOWER_EQUAL);
+        for (int j = 0; j < columns; ++j) {
+            model.addCoefficient(restriction, j, random.between(1, 9));
+        }
+        model.setRightSide(restriction, random.between(10, 100)*columns);
+    }
+    std::string error;
+    return model.build(error);
+}
+
+/**
+ * Same cell operations as a pivot on Numbers: line - pivotLine*equalizer, then the division
+ * of the pivot line, over a few lines that stay in the cache
+ */
+static bool numberArithmetic(int size, int rounds) {
+    std::vector<Value::Number> line(size);
+    std::vector<Value::Number> pivotLine(size);
+    for (int j = 0; j < size; ++j) {
+        line[j] = Value::Number(1 + j % 7, (j % 5 == 0) ? -1 : 0);
+        pivotLine[j] = Value::Number(1 + j % 3, 0);
+    }
+
+    Bench::clock::time_point begin = Bench::clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        Value::Number equalizer(1.0/(r+2), 0);
+        for (int j = 0; j < size; ++j) {
+            line[j] = line[j] - pivotLine[j]*equalizer;
+        }
+    }
+    double subtract = Bench::nanoseconds(begin, Bench::clock::now());
+
+    begin = Bench::clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        Value::Number divisor(1 + 1.0/(r+2), 0);
+        for (int j = 0; j < size; ++j) {
+            pivotLine[j] = pivotLine[j]/divisor;
+        }
+    }
+    double divide = Bench::nanoseconds(begin, Bench::clock::now());
+
+    // So the loops can't be dropped
+    double total = 0;
+    for (int j = 0; j < size; ++j) {
+        total += line[j].getValue() + pivotLine[j].getValue();
+    }
+
+    double operations = static_cast<double>(size)*rounds;
+    std::cout << Bench::Line("number_multiply_subtract").add("cells", size).add("rounds", rounds)
+                 .add("ns_per_iteration", subtract/operations).add("peak_rss_kb", Bench::peakRssKb())
+                 .to_string() << std::endl;
+    std::cout << Bench::Line("number_divide").add("cells", size).add("rounds", rounds)
+                 .add("ns_per_iteration", divide/operations).add("peak_rss_kb", Bench::peakRssKb())
+                 .to_string() << std::endl;
+    return total == total;
+}
+
+/**
+ * Pivots on synthetic tables, timing calculateCjZj, calculateTheta and executeIterationChange
+ * on their own. A table that gets to the optimum is replaced by the next one
+ */
+static bool tableSteps(int rows, int columns, int pivots) {
+    double cjzj = 0;
+    double theta = 0;
+    double change = 0;
+    int done = 0;
+    int seed = 0;
+    LinearSystems::System * system = nullptr;
+    Solver::Table * table = nullptr;
+
+    while (done < pivots) {
+        if (table == nullptr) {
+            system = synthetic(rows, columns, ++seed);
+            if (system == nullptr) {
+                return false;
+            }
+            table = new Solver::Table(system);
+        }
+
+        Bench::clock::time_point begin = Bench::clock::now();
+        table->calculateCjZj();
+        Bench::clock::time_point end = Bench::clock::now();
+
+        Solver::status solution = table->evaluateCjZj();
+        Solver::status ratio = Solver::WORK;
+        Bench::clock::time_point thetaBegin;
+        Bench::clock::time_point thetaEnd;
+        if (solution == Solver::WORK) {
+            thetaBegin = Bench::clock::now();
+            ratio = table->calculateTheta();
+            thetaEnd = Bench::clock::now();
+        }
+        if (solution != Solver::WORK || ratio != Solver::WORK) {
+            // Optimal already, this one's pivots are over
+            delete table;
+            delete system;
+            table = nullptr;
+            continue;
+        }
+        cjzj += Bench::nanoseconds(begin, end);
+        theta += Bench::nanoseconds(thetaBegin, thetaEnd);
+
+        table->updateBaseVariables();
+        begin = Bench::clock::now();
+        table->executeIterationChange();
+        change += Bench::nanoseconds(begin, Bench::clock::now());
+        ++done;
+    }
+    delete table;
+    delete system;
+
+    long peak = Bench::peakRssKb();
+    std::cout << Bench::Line("calculate_cjzj").add("rows", rows).add("columns", columns).add("calls", done)
+                 .add("ns_per_iteration", cjzj/done).add("peak_rss_kb", peak).to_string() << std::endl;
+    std::cout << Bench::Line("calculate_theta").add("rows", rows).add("columns", columns).add("calls", done)
+                 .add("ns_per_iteration", theta/done).add("peak_rss_kb", peak).to_string() << std::endl;
+    std::cout << Bench::Line("execute_iteration_change").add("rows", rows).add("columns", columns).add("calls", done)
+                 .add("ns_per_iteration", change/done).add("pivots_per_second", 1e9*done/change)
+                 .add("peak_rss_kb", peak).to_string() << std::endl;
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    // A single size if it's given: rows columns pivots
+    if (argc > 3) {
+        return tableSteps(std::atoi(argv[1]), std::atoi(argv[2]), std::atoi(argv[3])) ? 0 : 1;
+    }
+
+    bool passed = Bench::isolated([] { return numberArithmetic(4096, 20000); });
+    const int sizes[][3] = {{50, 100, 400}, {200, 400, 200}, {500, 1000, 50}};
+    for (const int * size : sizes) {
+        passed = Bench::isolated([size] { return tableSteps(size[0], size[1], size[2]); }) && passed;
+    }
+    return passed ? 0 : 1;
+}
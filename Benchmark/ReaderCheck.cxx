@@ -0,0 +1,252 @@
+/**
+ * @file ReaderCheck.cxx
+ * @brief Reads small MPS and LP models and solves them, failing when a reader turns down a model
+ * it should take, the optimum isn't the one known for it or the formats and ways of reading
+ * a file don't agree
+ * @version 0.1
+ *
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Representation/Readers/Reader.hxx"
+#include "../Solver/Solve.hxx"
+
+namespace {
+
+    const double TOLERANCE = 1e-6;
+
+    struct readerCase {
+        std::string name;
+        Readers::modelFormat format;
+        std::string text;
+        double expected;
+        std::vector<double> values;
+    };
+
+    const char * engineName(Solver::engineType engine) {
+        return engine == Solver::REVISED ? "revised" : engine == Solver::TWO_PHASE ? "two-phase" : "tableau";
+    }
+
+    // min 2x1 + 3x2, x1 + x2 >= 4, x1 + 3x2 >= 6, x1 <= 100: 9 at (3, 1)
+    const char * DIET_LP =
+        "\\ Diet\n"
+        "Minimize\n"
+        " cost: 2 x1 + 3 x2\n"
+        "Subject To\n"
+        " lim1: x1 + x2 >= 4\n"
+        " lim2: x1 + 3 x2 >= 6\n"
+        "Bounds\n"
+        " x1 <= 100\n"
+        "End\n";
+
+    const char * DIET_MPS =
+        "NAME DIET\n"
+        "ROWS\n"
+        " N cost\n"
+        " G lim1\n"
+        " G lim2\n"
+        "COLUMNS\n"
+        " x1 cost 2 lim1 1\n"
+        " x1 lim2 1\n"
+        " x2 cost 3 lim1 1\n"
+        " x2 lim2 3\n"
+        "RHS\n"
+        " RHS lim1 4 lim2 6\n"
+        "BOUNDS\n"
+        " UP BND x1 100\n"
+        "ENDATA\n";
+
+    // Names with spaces, only the columns of fixed MPS can tell them apart
+    const char * DIET_FIXED_MPS =
+        "NAME          DIET\n"
+        "ROWS\n"
+        " N  COST\n"
+        " G  LIM 1\n"
+        " G  LIM 2\n"
+        "COLUMNS\n"
+        "    X 1       COST               2.0   LIM 1              1.0\n"
+        "    X 1       LIM 2              1.0\n"
+        "    X 2       COST               3.0   LIM 1              1.0\n"
+        "    X 2       LIM 2              3.0\n"
+        "RHS\n"
+        "    RHS       LIM 1              4.0   LIM 2              6.0\n"
+        "BOUNDS\n"
+        " UP BND       X 1              100.0\n"
+        "ENDATA\n";
+
+    // min x + 2y, x + y >= -3, x - y <= 4, -5 <= x <= 10, y >= -2: -5 at (-1, -2)
+    const char * NEGATIVE_LP =
+        "Minimize\n"
+        " obj: x + 2 y\n"
+        "Subject To\n"
+        " c1: x + y >= -3\n"
+        " c2: x - y <= 4\n"
+        "Bounds\n"
+        " -5 <= x <= 10\n"
+        " y >= -2\n"
+        "End\n";
+
+    const char * NEGATIVE_MPS =
+        "NAME NEGATIVE\n"
+        "ROWS\n"
+        " N obj\n"
+        " G c1\n"
+        " L c2\n"
+        "COLUMNS\n"
+        " x obj 1 c1 1\n"
+        " x c2 1\n"
+        " y obj 2 c1 1\n"
+        " y c2 -1\n"
+        "RHS\n"
+        " RHS c1 -3 c2 4\n"
+        "BOUNDS\n"
+        " LO BND x -5\n"
+        " UP BND x 10\n"
+        " LO BND y -2\n"
+        "ENDATA\n";
+
+    bool solveCase(const readerCase &input, Solver::engineType engine) {
+        std::string error;
+        LinearSystems::System * system = Readers::readModelText(input.text, input.format, error);
+        if (system == nullptr) {
+            std::cout << input.name << ": " << error << std::endl;
+            return false;
+        }
+        Solver::solveOptions options;
+        options.engine = engine;
+        Solver::solveResult result = Solver::solve(system, options);
+        delete system;
+
+        std::string problem;
+        if (!result.isOptimal()) {
+            problem = result.error.empty() ? "ended with " + Solver::to_string(result.solution) : result.error;
+        } else if (std::fabs(result.objective - input.expected) > TOLERANCE*(1 + std::fabs(input.expected))) {
+            problem = "objective " + std::to_string(result.objective) + ", not " + std::to_string(input.expected);
+        }
+        for (std::size_t j = 0; problem.empty() && j < input.values.size(); ++j) {
+            if (j >= result.values.size() || std::fabs(result.values[j] - input.values[j]) > TOLERANCE) {
+                problem = "x" + std::to_string(j+1) + " isn't " + std::to_string(input.values[j]);
+            }
+        }
+        if (!problem.empty()) {
+            std::cout << input.name << " (" << engineName(engine) << "): " << problem << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool check(const readerCase &input) {
+        bool passed = true;
+        for (Solver::engineType engine : {Solver::TABLEAU, Solver::TWO_PHASE}) {
+            passed = solveCase(input, engine) && passed;
+        }
+        if (passed) {
+            std::cout << input.name << ": ok" << std::endl;
+        }
+        return passed;
+    }
+
+    // A file is mapped (see MappedFile) or read through a buffer, both have to give the same model
+    bool fileReading() {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "solver_reader_check.lp";
+        {
+            std::ofstream file(path);
+            file << DIET_LP;
+        }
+        bool passed = true;
+        for (bool mapped : {true, false}) {
+            std::string error;
+            LinearSystems::System * system = Readers::readModel(path.string(), Readers::CPLEX_LP, error, mapped);
+            Solver::solveResult result;
+            if (system != nullptr) {
+                result = Solver::solve(system, Solver::solveOptions());
+                delete system;
+            }
+            if (!result.isOptimal() || std::fabs(result.objective - 9) > TOLERANCE) {
+                std::cout << "file_" << (mapped ? "mapped" : "buffered") << ": "
+                          << (error.empty() ? "objective " + std::to_string(result.objective) : error) << std::endl;
+                passed = false;
+            }
+        }
+        std::filesystem::remove(path);
+        if (passed) {
+            std::cout << "file_mapped_buffered: ok" << std::endl;
+        }
+        return passed;
+    }
+
+    // A broken model says where it broke, the line of End here, as b could have been on the next line
+    bool brokenLine() {
+        std::string error;
+        LinearSystems::System * system = Readers::readModelText(
+            "Maximize\n obj: x + y\nSubject To\n c1: x + y <=\nEnd\n", Readers::CPLEX_LP, error);
+        delete system;
+        if (system != nullptr || error.find("Line 5") == std::string::npos) {
+            std::cout << "broken_line: " << (system != nullptr ? "read" : error) << std::endl;
+            return false;
+        }
+        std::cout << "broken_line: ok" << std::endl;
+        return true;
+    }
+
+    // The revised engine only knows x >= 0, it has to say so instead of solving another model
+    bool negativeOnRevised() {
+        std::string error;
+        LinearSystems::System * system = Readers::readModelText(NEGATIVE_LP, Readers::CPLEX_LP, error);
+        if (system == nullptr) {
+            std::cout << "negative_lower_revised: " << error << std::endl;
+            return false;
+        }
+        Solver::solveOptions options;
+        options.engine = Solver::REVISED;
+        Solver::solveResult result = Solver::solve(system, options);
+        delete system;
+        if (result.error.empty()) {
+            std::cout << "negative_lower_revised: solved it, to " << result.objective << std::endl;
+            return false;
+        }
+        std::cout << "negative_lower_revised: ok" << std::endl;
+        return true;
+    }
+
+    // Free variables still have no place in the table
+    bool freeTurnedDown() {
+        std::string error;
+        LinearSystems::System * system = Readers::readModelText(
+            "Maximize\n obj: x\nSubject To\n c1: x <= 4\nBounds\n x free\nEnd\n", Readers::CPLEX_LP, error);
+        delete system;
+        if (system != nullptr) {
+            std::cout << "free_variable: read" << std::endl;
+            return false;
+        }
+        std::cout << "free_variable: ok" << std::endl;
+        return true;
+    }
+
+};
+
+int main() {
+    std::vector<readerCase> cases = {
+        {"diet_lp", Readers::CPLEX_LP, DIET_LP, 9, {3, 1}},
+        {"diet_mps", Readers::FREE_MPS, DIET_MPS, 9, {3, 1}},
+        {"diet_fixed_mps", Readers::FIXED_MPS, DIET_FIXED_MPS, 9, {3, 1}},
+        {"negative_lower_lp", Readers::CPLEX_LP, NEGATIVE_LP, -5, {-1, -2}},
+        {"negative_lower_mps", Readers::FREE_MPS, NEGATIVE_MPS, -5, {-1, -2}},
+    };
+
+    bool passed = true;
+    for (const readerCase &input : cases) {
+        passed = check(input) && passed;
+    }
+    passed = fileReading() && passed;
+    passed = brokenLine() && passed;
+    passed = negativeOnRevised() && passed;
+    passed = freeTurnedDown() && passed;
+    return passed ? 0 : 1;
+}
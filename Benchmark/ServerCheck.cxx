@@ -0,0 +1,133 @@
+/**
+ * @file ServerCheck.cxx
+ * @brief Answers requests as the server workers do, failing when an answer doesn't follow the
+ * protocol (see Server) or the memory keeps growing with the solves of the same cached model
+ * @version 0.1
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hxx"
+#include "../Solver/Server.hxx"
+
+namespace {
+
+    bool has(const std::string &answer, const std::string &field) {
+        return answer.find(field) != std::string::npos;
+    }
+
+    const char * WYNDOR =
+        "Maximize\n"
+        " z: 3 x + 5 y\n"
+        "Subject To\n"
+        " plant1: x <= 4\n"
+        " plant2: 2 y <= 12\n"
+        " plant3: 3 x + 2 y <= 18\n"
+        "End\n";
+
+    const char * WYNDOR_MPS =
+        "NAME WYNDOR\n"
+        "ROWS\n"
+        " N z\n"
+        " L plant1\n"
+        " L plant2\n"
+        " L plant3\n"
+        "COLUMNS\n"
+        " x z -3 plant1 1\n"
+        " x plant3 3\n"
+        " y z -5 plant2 2\n"
+        " y plant3 2\n"
+        "RHS\n"
+        " RHS plant1 4 plant2 12\n"
+        " RHS plant3 18\n"
+        "ENDATA\n";
+
+    struct protocolCase {
+        std::string name;
+        std::string request;
+        std::vector<std::string> fields;    // Every one has to be in the answer
+    };
+
+    // One server for all of them, in order, so the later ones find the model cached
+    bool protocol() {
+        std::vector<protocolCase> cases = {
+            {"first", std::string("id 1\n\n") + WYNDOR,
+             {"\"status\": \"DONE\"", "\"objective\": 36", "\"id\": \"1\"", "\"cached\": false", "\"warm\": false"}},
+            {"cached_warm", std::string("id 2\n\n") + WYNDOR,
+             {"\"objective\": 36", "\"cached\": true", "\"warm\": true"}},
+            {"rhs", std::string("rhs 3 12\nvalues\n\n") + WYNDOR,
+             {"\"objective\": 30", "\"values\": [0, 6]", "\"cached\": true"}},
+            {"revised", std::string("engine revised\npricing devex\n\n") + WYNDOR,
+             {"\"objective\": 36", "\"warm\": false"}},
+            {"mps", std::string("format mps\n\n") + WYNDOR_MPS,
+             {"\"sense\": \"min\"", "\"objective\": -36", "\"cached\": false"}},
+            {"escaped_id", std::string("id a\"b\\c\n\n") + WYNDOR,
+             {"\"id\": \"a\\\"b\\\\c\""}},
+            {"no_restriction", std::string("rhs 9 1\n\n") + WYNDOR,
+             {"\"status\": \"ERROR\"", "there is no restriction 9"}},
+            {"bad_header", std::string("engine simplex\n\n") + WYNDOR,
+             {"\"status\": \"ERROR\"", "invalid header line: engine simplex"}},
+            {"no_model", "id 3\n",
+             {"\"status\": \"ERROR\"", "no empty line", "\"id\": \"3\""}},
+        };
+
+        Solver::Server server("", 1, 4);
+        bool passed = true;
+        for (const protocolCase &input : cases) {
+            std::string answer = server.answer(input.request);
+            for (const std::string &field : input.fields) {
+                if (!has(answer, field)) {
+                    std::cout << "server_" << input.name << ": no " << field << " in " << answer << std::endl;
+                    passed = false;
+                    break;
+                }
+            }
+        }
+        if (passed) {
+            std::cout << "server_protocol: ok" << std::endl;
+        }
+        return passed;
+    }
+
+    /**
+     * The first solves settle the cache, the allocator and the pools, past them the peak memory
+     * shouldn't move: each solve gets back everything it takes
+     */
+    bool sameModelManyTimes() {
+        const int WARM_UP = 100;
+        const int SOLVES = 1500;
+        const long GROWTH_KB = 4096;
+        Solver::Server server("", 1, 4);
+        std::string model = Bench::randomLp(40, 50);
+
+        long settled = 0;
+        for (int k = 0; k < SOLVES; ++k) {
+            std::string answer = server.answer("rhs 1 " + std::to_string(1000 + k % 50) + "\n\n" + model);
+            if (!has(answer, "\"status\": \"DONE\"") || has(answer, "\"cached\": false") != (k == 0)) {
+                std::cout << "server_same_model: solve " << k << " answered " << answer << std::endl;
+                return false;
+            }
+            if (k == WARM_UP) {
+                settled = Bench::peakRssKb();
+            }
+        }
+        long growth = Bench::peakRssKb() - settled;
+        if (growth > GROWTH_KB) {
+            std::cout << "server_same_model: " << growth << " kB more after " << SOLVES - WARM_UP
+                      << " solves" << std::endl;
+            return false;
+        }
+        std::cout << "server_same_model: ok" << std::endl;
+        return true;
+    }
+
+};
+
+int main() {
+    bool passed = protocol();
+    passed = sameModelManyTimes() && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file SolveBench.cxx
+ * @brief Macro benchmarks: whole solves of generated random, transportation, assignment and Klee-Minty models
+ * @version 0.1
+ *
+ */
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hxx"
+#include "../Representation/Readers/Reader.hxx"
+#include "../Solver/Solve.hxx"
+
+namespace {
+
+    std::string name(const char * prefix, int index) {
+        return prefix + std::to_string(index+1);
+    }
+
+    // Max c*x over dense a*x <= b, plus a few sum(x) >= 1 lines for the artificial variables
+    void randomModel(Readers::ModelBuilder &model, int rows, int columns) {
+        Bench::Random random(rows*7919 + columns);
+        model.setAction(LinearSystems::MAX);
+        for (int j = 0; j < columns; ++j) {
+            model.addObjective(model.getVariable(name("x", j)), random.between(1, 20));
+        }
+        for (int i = 0; i < rows; ++i) {
+            bool covering = i % 10 == 9;
+            int restriction = model.addRestriction(name("r", i), covering ? LinearSystems::HIGHER_EQUAL :
+                                                                            LinearSystems::LOWER_EQUAL);
+            for (int j = 0; j < columns; ++j) {
+                model.addCoefficient(restriction, j, covering ? 1 : random.between(1, 9));
+            }
+            model.setRightSide(restriction, covering ? 1 : random.between(10, 100)*columns);
+        }
+    }
+
+    // Min cost of sending the supply of each source to each destination, supply and demand balanced
+    void transportationModel(Readers::ModelBuilder &model, int sources, int destinations) {
+        Bench::Random random(sources*104729 + destinations);
+        model.setAction(LinearSystems::MIN);
+        std::vector<int> supply(sources);
+        std::vector<int> demand(destinations, 0);
+        for (int i = 0; i < sources; ++i) {
+            supply[i] = random.between(10, 50)*destinations;
+            // Spread over the destinations, so the total is the same
+            for (int k = 0; k < supply[i]; ++k) {
+                ++demand[(i + k) % destinations];
+            }
+        }
+        for (int i = 0; i < sources; ++i) {
+            for (int j = 0; j < destinations; ++j) {
+                model.addObjective(model.getVariable("x" + std::to_string(i+1) + "_" + std::to_string(j+1)),
+                                   random.between(1, 30));
+            }
+        }
+        for (int i = 0; i < sources; ++i) {
+            int restriction = model.addRestriction(name("s", i), LinearSystems::LOWER_EQUAL);
+            for (int j = 0; j < destinations; ++j) {
+                model.addCoefficient(restriction, i*destinations + j, 1);
+            }
+            model.setRightSide(restriction, supply[i]);
+        }
+        for (int j = 0; j < destinations; ++j) {
+            int restriction = model.addRestriction(name("d", j), LinearSystems::HIGHER_EQUAL);
+            for (int i = 0; i < sources; ++i) {
+                model.addCoefficient(restriction, i*destinations + j, 1);
+            }
+            model.setRightSide(restriction, demand[j]);
+        }
+    }
+
+    // Min cost of giving each worker exactly one task, every line is an equality (degenerate)
+    void assignmentModel(Readers::ModelBuilder &model, int size) {
+        Bench::Random random(size*15485863);
+        model.setAction(LinearSystems::MIN);
+        for (int i = 0; i < size; ++i) {
+            for (int j = 0; j < size; ++j) {
+                model.addObjective(model.getVariable("x" + std::to_string(i+1) + "_" + std::to_string(j+1)),
+                                   random.between(1, 100));
+            }
+        }
+        for (int i = 0; i < size; ++i) {
+            int worker = model.addRestriction(name("w", i), LinearSystems::EQUAL);
+            int task = model.addRestriction(name("t", i), LinearSystems::EQUAL);
+            for (int j = 0; j < size; ++j) {
+                model.addCoefficient(worker, i*size + j, 1);
+                model.addCoefficient(task, j*size + i, 1);
+            }
+            model.setRightSide(worker, 1);
+            model.setRightSide(task, 1);
+        }
+    }
+
+    // Dantzig's rule visits all 2^n vertices of this cube, the optimum is 5^n
+    void kleeMintyModel(Readers::ModelBuilder &model, int size) {
+        model.setAction(LinearSystems::MAX);
+        for (int j = 0; j < size; ++j) {
+            model.addObjective(model.getVariable(name("x", j)), std::pow(2.0, size-1-j));
+        }
+        for (int i = 0; i < size; ++i) {
+            int restriction = model.addRestriction(name("r", i), LinearSystems::LOWER_EQUAL);
+            for (int j = 0; j < i; ++j) {
+                model.addCoefficient(restriction, j, std::pow(2.0, i-j+1));
+            }
+            model.addCoefficient(restriction, i, 1);
+            model.setRightSide(restriction, std::pow(5.0, i+1));
+        }
+    }
+
+    struct macroCase {
+        std::string name;
+        std::string size;
+        std::function<void(Readers::ModelBuilder &)> generate;
+    };
+
+    const char * engineName(Solver::engineType engine) {
+        return engine == Solver::REVISED ? "revised" : engine == Solver::TWO_PHASE ? "two-phase" : "tableau";
+    }
+
+    // Same model, solved once on the other engine, so the two can be compared
+    bool otherObjective(const macroCase &model, Solver::engineType engine, double &objective) {
+        Solver::solveOptions options;
+        options.engine = engine == Solver::REVISED ? Solver::TABLEAU : Solver::REVISED;
+        Readers::ModelBuilder builder;
+        model.generate(builder);
+        Solver::solveResult result = Solver::solve(builder, options);
+        if (!result.isOptimal()) {
+            std::cerr << model.name << " " << model.size << " (" << engineName(options.engine) << "): "
+                      << (result.error.empty() ? Solver::to_string(result.solution) : result.error) << std::endl;
+            return false;
+        }
+        objective = result.objective;
+        return true;
+    }
+
+    /**
+     * Solves the model again and again for at least MIN_SECONDS (the model is built every time,
+     * only the solves are timed). The peak memory is the one of the first solve, the table
+     * doesn't give all of it back
+     * False, with no line, if it didn't get to the optimum or the other engine found another one
+     */
+    bool run(const macroCase &model, Solver::engineType engine) {
+        const double MIN_SECONDS = 0.3;
+        const double TOLERANCE = 1e-6;
+        Solver::solveOptions options;
+        options.engine = engine;
+
+        double elapsed = 0;
+        long pivots = 0;
+        int solves = 0;
+        long peak = 0;
+        Solver::solveResult result;
+        while (solves == 0 || elapsed < MIN_SECONDS*1e9) {
+            Readers::ModelBuilder builder;
+            model.generate(builder);
+            LinearSystems::System * system = builder.build(result.error);
+            if (system == nullptr) {
+                std::cerr << model.name << ": " << result.error << std::endl;
+                return false;
+            }
+            Bench::clock::time_point begin = Bench::clock::now();
+            result = Solver::solve(system, options);
+            elapsed += Bench::nanoseconds(begin, Bench::clock::now());
+            delete system;
+            if (!result.isOptimal()) {
+                std::cerr << model.name << " " << model.size << " (" << engineName(engine) << "): "
+                          << (result.error.empty() ? Solver::to_string(result.solution) : result.error) << std::endl;
+                return false;
+            }
+            pivots += result.iterations;
+            if (solves++ == 0) {
+                peak = Bench::peakRssKb();
+            }
+        }
+
+        double other = 0;
+        if (!otherObjective(model, engine, other)) {
+            return false;
+        }
+        if (std::fabs(result.objective - other) > TOLERANCE*(1 + std::fabs(other))) {
+            std::cerr << model.name << " " << model.size << " (" << engineName(engine) << "): objective "
+                      << result.objective << ", the other engine has " << other << std::endl;
+            return false;
+        }
+
+        std::cout << Bench::Line(model.name).add("size", model.size).add("engine", engineName(engine))
+                     .add("status", Solver::to_string(result.solution)).add("objective", result.objective)
+                     .add("solves", solves).add("pivots", pivots/solves)
+                     .add("ns_per_iteration", pivots > 0 ? elapsed/pivots : 0)
+                     .add("pivots_per_second", elapsed > 0 ? 1e9*pivots/elapsed : 0)
+                     .add("ms_per_solve", elapsed/solves/1e6)
+                     .add("peak_rss_kb", peak).to_string() << std::endl;
+        return true;
+    }
+
+};
+
+int main() {
+    std::vector<macroCase> models = {
+        {"random", "100x200", [](Readers::ModelBuilder &model) { randomModel(model, 100, 200); }},
+        {"random", "300x600", [](Readers::ModelBuilder &model) { randomModel(model, 300, 600); }},
+        {"transportation", "20x30", [](Readers::ModelBuilder &model) { transportationModel(model, 20, 30); }},
+        {"assignment", "15x15", [](Readers::ModelBuilder &model) { assignmentModel(model, 15); }},
+        {"klee_minty", "12", [](Readers::ModelBuilder &model) { kleeMintyModel(model, 12); }},
+    };
+
+    bool passed = true;
+    for (const macroCase &model : models) {
+        for (Solver::engineType engine : {Solver::TABLEAU, Solver::REVISED}) {
+            passed = Bench::isolated([&model, engine] { return run(model, engine); }) && passed;
+        }
+    }
+    return passed ? 0 : 1;
+}
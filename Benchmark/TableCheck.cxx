@@ -0,0 +1,352 @@
+/**
+ * @file TableCheck.cxx
+ * @brief Checks what is kept of a table outside of it: snapshots, basis files, the presolved
+ * system and the history, failing when what comes back doesn't solve or show the same
+ * @version 0.1
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hxx"
+#include "../Representation/Readers/Reader.hxx"
+#include "../Solver/Basis.hxx"
+#include "../Solver/History.hxx"
+#include "../Solver/Presolve.hxx"
+#include "../Solver/Snapshot.hxx"
+#include "../Solver/Solve.hxx"
+#include "../Solver/Table.hxx"
+
+namespace {
+
+    const double TOLERANCE = 1e-6;
+
+    const char * WYNDOR =
+        "Maximize\n"
+        " z: 3 x + 5 y\n"
+        "Subject To\n"
+        " plant1: x <= 4\n"
+        " plant2: 2 y <= 12\n"
+        " plant3: 3 x + 2 y <= 18\n"
+        "End\n";
+
+    /**
+     * Wyndor with a fixed variable, a restriction that is a multiple of another and one that is
+     * only a bound: presolve has something to remove. 39 at (4/3, 6, 2, 1)
+     */
+    const char * REDUCIBLE =
+        "Maximize\n"
+        " z: 3 x + 5 y + 2 s + w\n"
+        "Subject To\n"
+        " plant1: x <= 4\n"
+        " plant2: 2 y <= 12\n"
+        " plant3: 3 x + 2 y + s <= 18\n"
+        " double3: 6 x + 4 y + 2 s <= 40\n"
+        " extra: s + w <= 3\n"
+        "Bounds\n"
+        " 1 <= w <= 1\n"
+        "End\n";
+
+    // Klee-Minty cube of 4 variables, Dantzig pricing walks 15 of its corners
+    const char * KLEE_MINTY =
+        "Maximize\n"
+        " z: 1000 x1 + 100 x2 + 10 x3 + x4\n"
+        "Subject To\n"
+        " c1: x1 <= 1\n"
+        " c2: 20 x1 + x2 <= 100\n"
+        " c3: 200 x1 + 20 x2 + x3 <= 10000\n"
+        " c4: 2000 x1 + 200 x2 + 20 x3 + x4 <= 1000000\n"
+        "End\n";
+
+    LinearSystems::System * read(const std::string &text, const std::string &name) {
+        std::string error;
+        LinearSystems::System * system = Readers::readModelText(text, Readers::CPLEX_LP, error);
+        if (system == nullptr) {
+            std::cout << name << ": " << error << std::endl;
+        }
+        return system;
+    }
+
+    bool same(const std::vector<double> &first, const std::vector<double> &second) {
+        if (first.size() != second.size()) {
+            return false;
+        }
+        for (std::size_t j = 0; j < first.size(); ++j) {
+            if (std::fabs(first[j] - second[j]) > TOLERANCE*(1 + std::fabs(first[j]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Pivots up to count times, stopping early at the optimum
+    void pivot(Solver::Table * table, int count) {
+        for (int k = 0; k < count; ++k) {
+            table->calculateCjZj();
+            if (table->evaluateCjZj() != Solver::WORK || table->calculateTheta() != Solver::WORK) {
+                return;
+            }
+            table->updateBaseVariables();
+            table->executeIterationChange();
+        }
+    }
+
+    // Pivots until the table stops, stopping early at the optimum
+    void pivot(Solver::Table * table) {
+        pivot(table, 1000);
+    }
+
+    /**
+     * The system alone, and a system with its table half way (a table adds its slacks to the
+     * system it solves, so each solve reads its own). Then a file that isn't a snapshot
+     */
+    bool snapshot() {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "solver_table_check.snap";
+        std::string model = Bench::randomLp(12, 15);
+        LinearSystems::System * system = read(model, "snapshot");
+        if (system == nullptr) {
+            return false;
+        }
+        Solver::solveResult expected = Solver::solve(system, Solver::solveOptions());
+        delete system;
+
+        std::string problem;
+        std::string error;
+        LinearSystems::System * loaded = nullptr;
+        Solver::Table * loadedTable = nullptr;
+        system = read(model, "snapshot");
+        if (!Solver::Snapshot::save(path.string(), system, nullptr, error) ||
+            !Solver::Snapshot::load(path.string(), loaded, loadedTable, error)) {
+            problem = error;
+        } else if (loadedTable != nullptr) {
+            problem = "a table came from nowhere";
+        } else {
+            Solver::solveResult result = Solver::solve(loaded, Solver::solveOptions());
+            if (!result.isOptimal() || std::fabs(result.objective - expected.objective) > TOLERANCE ||
+                !same(result.values, expected.values)) {
+                problem = "the loaded system solves to " + std::to_string(result.objective) +
+                          ", not " + std::to_string(expected.objective);
+            }
+        }
+        delete loadedTable;
+        delete loaded;
+        loaded = nullptr;
+        loadedTable = nullptr;
+
+        // Both tables go on from where it was saved to the same optimum
+        Solver::Table * table = new Solver::Table(system);
+        pivot(table, 1);
+        if (!problem.empty()) {
+        } else if (!Solver::Snapshot::save(path.string(), system, table, error) ||
+                   !Solver::Snapshot::load(path.string(), loaded, loadedTable, error)) {
+            problem = error;
+        } else if (loadedTable == nullptr) {
+            problem = "the table was lost";
+        } else if (loadedTable->to_string() != table->to_string()) {
+            problem = "the table isn't the one saved";
+        } else {
+            pivot(table);
+            pivot(loadedTable);
+            std::vector<double> values = loadedTable->getValues();
+            values.resize(expected.values.size());    // Without the slacks
+            if (loadedTable->to_string() != table->to_string() || !same(values, expected.values)) {
+                problem = "the loaded table ended somewhere else";
+            }
+        }
+        delete loadedTable;
+        delete loaded;
+        delete table;
+        delete system;
+
+        if (problem.empty()) {
+            {
+                std::ofstream file(path);
+                file << WYNDOR;
+            }
+            loaded = nullptr;
+            loadedTable = nullptr;
+            if (Solver::Snapshot::load(path.string(), loaded, loadedTable, error)) {
+                problem = "an LP file loaded as a snapshot";
+                delete loadedTable;
+                delete loaded;
+            }
+        }
+        std::filesystem::remove(path);
+
+        if (!problem.empty()) {
+            std::cout << "snapshot: " << problem << std::endl;
+            return false;
+        }
+        std::cout << "snapshot: ok" << std::endl;
+        return true;
+    }
+
+    // The optimal base goes to a file and back, starting from it there is nothing left to pivot
+    bool basis() {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "solver_table_check.bas";
+        std::string model = Bench::randomLp(20, 25);
+        LinearSystems::System * system = read(model, "basis");
+        if (system == nullptr) {
+            return false;
+        }
+        Solver::solveResult cold = Solver::solve(system, Solver::solveOptions());
+        delete system;
+
+        std::string error;
+        std::vector<int> columns;
+        system = read(model, "basis");
+        Solver::Table * table = new Solver::Table(system);
+        const Solver::Tableau &tableau = table->getTable();
+        bool saved = table->importBasis(cold.basis, error) && Solver::Basis::save(path.string(), table, error) &&
+                     Solver::Basis::load(path.string(), tableau.getRows()-1, tableau.getColumns()-2, columns, error);
+        delete table;
+        delete system;
+        std::filesystem::remove(path);
+
+        // Same base, importBasis may have put it on other lines
+        std::vector<int> expected = cold.basis;
+        std::sort(expected.begin(), expected.end());
+        std::sort(columns.begin(), columns.end());
+        std::string problem = error;
+        if (saved && columns != expected) {
+            problem = "the base read isn't the one saved";
+        } else if (saved) {
+            Solver::solveOptions options;
+            options.basis = columns;
+            system = read(model, "basis");
+            Solver::solveResult warm = Solver::solve(system, options);
+            delete system;
+            if (!warm.warmStarted || warm.iterations != 0) {
+                problem = "the warm start took " + std::to_string(warm.iterations) + " iterations";
+            } else if (!warm.isOptimal() || std::fabs(warm.objective - cold.objective) > TOLERANCE ||
+                       !same(warm.values, cold.values)) {
+                problem = "the warm start ended somewhere else";
+            }
+        }
+
+        if (!problem.empty()) {
+            std::cout << "basis: " << problem << std::endl;
+            return false;
+        }
+        std::cout << "basis: ok" << std::endl;
+        return true;
+    }
+
+    // Presolve removes something, and what postsolve gives back is the optimum of every engine
+    bool presolve() {
+        LinearSystems::System * system = read(REDUCIBLE, "presolve");
+        if (system == nullptr) {
+            return false;
+        }
+        std::string problem;
+        {
+            // As solve does it, the bounds are restrictions by then
+            int restrictions = system->getNumberOfRestrictions();
+            system->boundsToRestrictions();
+            Solver::Presolve presolved(system);
+            Solver::status reduced = presolved.run();
+            if (reduced != Solver::DONE && (reduced != Solver::WORK ||
+                presolved.getReduced()->getNumberOfRestrictions() >= restrictions)) {
+                problem = "nothing was removed";
+            }
+            delete presolved.getReduced();
+        }
+        delete system;
+
+        // A table takes the system as its own (its slacks are added to it), each solve reads it again
+        for (Solver::engineType engine : {Solver::TABLEAU, Solver::TWO_PHASE, Solver::REVISED}) {
+            if (!problem.empty()) {
+                break;
+            }
+            Solver::solveResult results[2];
+            for (bool presolved : {false, true}) {
+                system = read(REDUCIBLE, "presolve");
+                Solver::solveOptions options;
+                options.engine = engine;
+                options.presolve = presolved;
+                results[presolved] = Solver::solve(system, options);
+                delete system;
+            }
+            const Solver::solveResult &plain = results[0];
+            const Solver::solveResult &presolved = results[1];
+            if (!plain.isOptimal() || !presolved.isOptimal()) {
+                problem = "engine " + std::to_string(engine) + " didn't solve it";
+            } else if (std::fabs(plain.objective - 39) > TOLERANCE ||
+                       std::fabs(presolved.objective - plain.objective) > TOLERANCE) {
+                problem = "engine " + std::to_string(engine) + " got " + std::to_string(plain.objective) +
+                          " and " + std::to_string(presolved.objective) + " presolved";
+            } else if (!same(presolved.values, plain.values)) {
+                problem = "engine " + std::to_string(engine) + " postsolved other values";
+            }
+        }
+
+        if (!problem.empty()) {
+            std::cout << "presolve: " << problem << std::endl;
+            return false;
+        }
+        std::cout << "presolve: ok" << std::endl;
+        return true;
+    }
+
+    // Every iteration the history still keeps is rebuilt as the table showed it then
+    bool history() {
+        LinearSystems::System * system = read(KLEE_MINTY, "history");
+        if (system == nullptr) {
+            return false;
+        }
+        Solver::Table * table = new Solver::Table(system);
+        Solver::History kept(3, 2);
+        std::vector<std::string> shown;
+        while (true) {
+            table->calculateCjZj();
+            if (table->evaluateCjZj() != Solver::WORK || table->calculateTheta() != Solver::WORK) {
+                break;
+            }
+            kept.record(*table);
+            shown.push_back(table->to_string());
+            table->updateBaseVariables();
+            table->executeIterationChange();
+        }
+
+        std::string problem;
+        if (kept.getSize() <= 3*2) {    // Past what the checkpoints kept cover
+            problem = "only " + std::to_string(kept.getSize()) + " iterations";
+        } else if (!kept.matches(*table)) {
+            problem = "the history doesn't match its own table";
+        }
+        for (int k = kept.getFirst(); problem.empty() && k < kept.getSize(); ++k) {
+            Solver::Tableau past;
+            std::vector<int> base;
+            if (!kept.rebuild(k, past, base, problem)) {
+                break;
+            }
+            if (table->to_string(past, base) != shown[k]) {
+                problem = "iteration " + std::to_string(k) + " isn't the one shown";
+            }
+        }
+        delete table;
+        delete system;
+
+        if (!problem.empty()) {
+            std::cout << "history: " << problem << std::endl;
+            return false;
+        }
+        std::cout << "history: ok" << std::endl;
+        return true;
+    }
+
+};
+
+int main() {
+    bool passed = snapshot();
+    passed = basis() && passed;
+    passed = presolve() && passed;
+    passed = history() && passed;
+    return passed ? 0 : 1;
+}
@@ -12,6 +12,14 @@
 #include "Helper.hxx"
 #include <cmath>
 #include <cctype>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#endif
 
 void Helper::isAllDigits(std::string input, int &outputValue) {
     bool isNumber = true;
@@ -28,3 +36,16 @@ void Helper::isAllDigits(std::string input, int &outputValue) {
     return;
 }
 
+void Helper::clearScreen() {
+#ifdef _WIN32
+    // The Windows console only takes escape sequences once asked to
+    static bool enabled = [] {
+        HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+        DWORD mode = 0;
+        return GetConsoleMode(output, &mode) && SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    }();
+    (void) enabled;
+#endif
+    // Erase the screen and go back to the top left corner, like clear and cls do
+    std::cout << "\033[2J\033[H" << std::flush;
+}
@@ -19,4 +19,7 @@ class Helper {
 
         static void isAllDigits(std::string input, int &outputValue);
 
+        // Clears the console through an escape sequence, no shell is started for it
+        static void clearScreen();
+
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+/**
+ * @file MappedFile.cxx
+ * @brief File implements a read only memory mapping of a whole file
+ * @version 0.1
+ *
+ */
+
+#include "MappedFile.hxx"
+
+#ifdef _WIN32
+
+#include <fstream>
+
+// No mmap, the whole file is read into the buffer instead
+MappedFile::MappedFile(const std::string &path, bool) : data(nullptr), size(0) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return;
+    }
+    std::streamoff length = file.tellg();
+    // Same as the mapping, nothing for empty files or what can't tell its size
+    if (length <= 0) {
+        return;
+    }
+    buffer.resize(static_cast<std::size_t>(length));
+    file.seekg(0);
+    if (!file.read(buffer.data(), length)) {
+        buffer.clear();
+        return;
+    }
+    data = buffer.data();
+    size = buffer.size();
+}
+
+MappedFile::~MappedFile() {
+
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path, bool sequential) : data(nullptr), size(0) {
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor == -1) {
+        return;
+    }
+    struct stat information;
+    // Only regular, non empty files can be mapped
+    if (fstat(descriptor, &information) == -1 || !S_ISREG(information.st_mode) || information.st_size == 0) {
+        close(descriptor);
+        return;
+    }
+    void * address = mmap(nullptr, information.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // The mapping stays valid without the descriptor
+    close(descriptor);
+    if (address == MAP_FAILED) {
+        return;
+    }
+    if (sequential) {
+        madvise(address, information.st_size, MADV_SEQUENTIAL);
+    }
+    data = static_cast<const char *>(address);
+    size = information.st_size;
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(const_cast<char *>(data), size);
+    }
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file MappedFile.hxx
+ * @brief File declares a read only memory mapping of a whole file
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Maps a whole regular file read only, unmapped when destroyed
+ *
+ * Pipes, devices and empty files can't be mapped, isOpen() tells if it worked
+ * On Windows the file is read into memory instead, same interface
+ */
+class MappedFile {
+
+    public:
+
+        // sequential: the file is read once from start to end, so the kernel reads ahead
+        MappedFile(const std::string &path, bool sequential = true);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile& operator=(const MappedFile &) = delete;
+
+        bool isOpen() const { return data != nullptr; }
+
+        const char * getData() const { return data; }
+
+        std::size_t getSize() const { return size; }
+
+        std::string_view view() const { return std::string_view(data, size); }
+
+    private:
+
+        const char * data;
+        std::size_t size;
+
+#ifdef _WIN32
+        std::vector<char> buffer;
+#endif
+};
@@ -0,0 +1,87 @@
+/**
+ * @file ThreadPool.cxx
+ * @brief File implements a fixed size thread pool to split loops across cores
+ * @version 0.1
+ *
+ */
+
+#include "ThreadPool.hxx"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threadCount) :
+    threadCount(std::max(1, threadCount)), job(nullptr),
+    jobBegin(0), jobEnd(0), generation(0), pending(0), stopping(false) {
+
+    for (int i = 1; i < this->threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(int begin, int end, const std::function<void(int, int)> &work) {
+    if (end <= begin) {
+        return;
+    }
+    if (threadCount == 1) {
+        work(begin, end);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &work;
+        jobBegin = begin;
+        jobEnd = end;
+        pending = threadCount - 1;
+        ++generation;
+    }
+    wakeUp.notify_all();
+
+    // The caller takes the first block
+    runBlock(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return pending == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::runBlock(int index) {
+    int size = (jobEnd - jobBegin + threadCount - 1) / threadCount;
+    int blockBegin = std::min(jobEnd, jobBegin + index*size);
+    int blockEnd = std::min(jobEnd, blockBegin + size);
+    if (blockBegin < blockEnd) {
+        (*job)(blockBegin, blockEnd);
+    }
+}
+
+void ThreadPool::workerLoop(int index) {
+    unsigned long seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        runBlock(index);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --pending;
+        }
+        finished.notify_one();
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file ThreadPool.hxx
+ * @brief File declares a fixed size thread pool to split loops across cores
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+
+    public:
+
+        /**
+         * Creates threadCount - 1 workers, the thread calling parallelFor is the last one
+         */
+        ThreadPool(int threadCount);
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool& operator=(const ThreadPool &) = delete;
+
+        int getThreadCount() const { return threadCount; }
+
+        /**
+         * Splits [begin, end) in one contiguous block per thread and runs
+         * work(blockBegin, blockEnd) for each block, returning when all are done
+         *
+         * The blocks only depend on the range and the number of threads,
+         * so the same call always gives each thread the same block
+         */
+        void parallelFor(int begin, int end, const std::function<void(int, int)> &work);
+
+    private:
+
+        void workerLoop(int index);
+
+        void runBlock(int index);
+
+        int threadCount;
+
+        std::vector<std::thread> workers;
+
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::condition_variable finished;
+
+        const std::function<void(int, int)> * job;
+        int jobBegin;
+        int jobEnd;
+        unsigned long generation;
+        int pending;
+        bool stopping;
+};
@@ -0,0 +1,89 @@
+/**
+ * @file WorkStealingPool.cxx
+ * @brief File implements a thread pool for independent tasks of different sizes, idle threads steal from the busy ones
+ * @version 0.1
+ *
+ */
+
+#include "WorkStealingPool.hxx"
+#include <algorithm>
+#include <thread>
+
+WorkStealingPool::WorkStealingPool(int threadCount) : threadCount(std::max(1, threadCount)), steals(0) {
+    for (int i = 0; i < this->threadCount; ++i) {
+        queues.emplace_back(new queue());
+    }
+}
+
+void WorkStealingPool::run(int count, const std::function<void(int, int)> &task) {
+    steals = 0;
+    if (count <= 0) {
+        return;
+    }
+
+    // Contiguous blocks, the first threads take one more when it doesn't split evenly
+    int size = count / threadCount;
+    int extra = count % threadCount;
+    int next = 0;
+    for (int i = 0; i < threadCount; ++i) {
+        std::lock_guard<std::mutex> lock(queues[i]->mutex);
+        queues[i]->tasks.clear();
+        for (int k = 0; k < size + (i < extra ? 1 : 0); ++k) {
+            queues[i]->tasks.push_back(next++);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i, std::cref(task));
+    }
+    workerLoop(0, task);
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::workerLoop(int thread, const std::function<void(int, int)> &task) {
+    int index;
+    while (take(thread, index)) {
+        task(thread, index);
+    }
+}
+
+bool WorkStealingPool::take(int thread, int &index) {
+    {
+        std::lock_guard<std::mutex> lock(queues[thread]->mutex);
+        if (!queues[thread]->tasks.empty()) {
+            index = queues[thread]->tasks.front();
+            queues[thread]->tasks.pop_front();
+            return true;
+        }
+    }
+
+    // Tasks never come back to a queue, so once every one is empty the run is over
+    while (true) {
+        int victim = -1;
+        std::size_t largest = 0;
+        for (int i = 0; i < threadCount; ++i) {
+            if (i == thread) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(queues[i]->mutex);
+            if (queues[i]->tasks.size() > largest) {
+                largest = queues[i]->tasks.size();
+                victim = i;
+            }
+        }
+        if (victim == -1) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(queues[victim]->mutex);
+        // It may have emptied since it was looked at
+        if (!queues[victim]->tasks.empty()) {
+            index = queues[victim]->tasks.back();
+            queues[victim]->tasks.pop_back();
+            ++steals;
+            return true;
+        }
+    }
+}
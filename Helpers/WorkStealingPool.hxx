@@ -0,0 +1,62 @@
+/**
+ * @file WorkStealingPool.hxx
+ * @brief File declares a thread pool for independent tasks of different sizes, idle threads steal from the busy ones
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * ThreadPool splits one loop in equal blocks, which is right when every index costs the same
+ * Here each task can take any time (one model may need thousands of pivots, the next none):
+ *
+ *  1 - Each thread starts with its own contiguous block of tasks
+ *  2 - It takes them from the front of its own queue, so they mostly finish in order
+ *  3 - Once it's empty, it takes the last task of the fullest queue of the other threads
+ */
+class WorkStealingPool {
+
+    public:
+
+        WorkStealingPool(int threadCount);
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool &) = delete;
+
+        int getThreadCount() const { return threadCount; }
+
+        /**
+         * Runs task(thread, index) for every index in [0, count), on threadCount threads
+         * (the caller being one of them), returning when all are done
+         */
+        void run(int count, const std::function<void(int, int)> &task);
+
+        // Tasks a thread took from another one on the last run
+        long getSteals() const { return steals; }
+
+    private:
+
+        struct queue {
+            std::mutex mutex;
+            std::deque<int> tasks;
+        };
+
+        void workerLoop(int thread, const std::function<void(int, int)> &task);
+
+        // Front of its own queue, otherwise the back of the fullest other one. False once all are empty
+        bool take(int thread, int &index);
+
+        int threadCount;
+
+        std::vector< std::unique_ptr<queue> > queues;
+
+        std::atomic<long> steals;
+};
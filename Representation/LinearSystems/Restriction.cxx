@@ -10,13 +10,14 @@
  */
 
 #include "Restriction.hxx"
+#include "../../Helpers/Helper.hxx"
 #include <iostream>
 #include <algorithm>
 #include <utility>
 
 namespace LinearSystems {
 
-    std::vector <std::string> symbolVec {
+    const std::vector <std::string> symbolVec {
         "<",
         ">",
         "<=",
@@ -24,7 +25,7 @@ namespace LinearSystems {
         "="
     };
 
-    std::map<int, std::string> symbolMap {
+    const std::map<int, std::string> symbolMap {
         {LOWER, "<"},
         {HIGHER, ">"},
         {LOWER_EQUAL, "<="},
@@ -32,12 +33,17 @@ namespace LinearSystems {
         {EQUAL, "="}
     };
 
+    std::string symbolToString(int symbol) {
+        auto it = symbolMap.find(symbol);
+        return it == symbolMap.end() ? std::string() : it->second;
+    }
+
     Restriction::Restriction() {
 
     }
 
     Restriction::Restriction(int variables, int restrictionNumber, objType type) :
-        restrictionNumber(restrictionNumber), objectiveType(type), variableNumber(variables) {
+        restrictionNumber(restrictionNumber), variableNumber(variables), objectiveType(type) {
         /**
          * Create a restriction entirely from user input
          * For example:
@@ -47,10 +53,7 @@ namespace LinearSystems {
          * 1*x1 + 2*x2 + 12*x3 <= 4
          */
 
-        restrictionInstance = static_cast<restrictionItem *>(malloc(sizeof(restrictionItem) * (variableNumber+2)));
-        if (restrictionInstance == nullptr) {
-            std::cout << "Failed to create the restriction of " << variableNumber << " variables" << std::endl;
-        }
+        restrictionInstance.resize(variableNumber+2);
 
         std::string input;
         bool hasSymbol = false;
@@ -112,8 +115,35 @@ namespace LinearSystems {
         displayRestriction();
     }
 
-    Restriction::~Restriction() {
-        // Nothing lol
+    Restriction::Restriction(int restrictionNumber, const std::vector<Value::Number> &coefficients,
+                             symbolEnum symbol, Value::Number rightSide, objType type) :
+        restrictionNumber(restrictionNumber), variableNumber(coefficients.size()), objectiveType(type) {
+
+        restrictionInstance.resize(variableNumber+2);
+
+        for (int i = 0; i < variableNumber; ++i) {
+            Value::Number valueToStore = coefficients[i];
+            // Same as typing it, minimizing is maximizing the negative
+            if (objectiveType == MIN) {
+                valueToStore = valueToStore*-1;
+            }
+            restrictionInstance[i] = restrictionItem{VALUE, valueToStore};
+        }
+
+        if (type != NONE) {
+            // Objetive has no symbol and right side value
+            restrictionInstance[variableNumber] = restrictionItem{SYMBOL, Value::Number(EQUAL)};
+            restrictionInstance[variableNumber+1] = restrictionItem{VALUE, Value::Number(0)};
+            return;
+        }
+        restrictionInstance[variableNumber] = restrictionItem{SYMBOL, Value::Number(symbol)};
+        restrictionInstance[variableNumber+1] = restrictionItem{VALUE, rightSide};
+    }
+
+    Restriction::Restriction(int restrictionNumber, const std::vector<restrictionItem> &items, objType type) :
+        restrictionNumber(restrictionNumber), variableNumber(items.size()-2), objectiveType(type),
+        restrictionInstance(items) {
+
     }
 
     // Make sure remaining variables are 0*xn
@@ -147,31 +177,14 @@ namespace LinearSystems {
         return "0";
     }
 
-    bool Restriction::isDouble(std::string input) {
-        try {
-            size_t pos;
-
-            // Try the conversion
-            double result = std::stod(input, &pos);
-            
-            // Is there more text?
-            if (pos != input.size()) {
-                return false;
-            }
-            
-            // Number ok
-            return true;
-        } catch (const std::invalid_argument& e) {
-            // No number
-            return false;
-        } catch (const std::out_of_range& e) {
-            // Number too large :c wont fit in double variable
-            return false;
-        }
+    bool Restriction::isDouble(std::string_view input) {
+        // Whole text must be the number, too large ones fail too
+        double result;
+        return Value::Number::parse(input, result);
     }
 
     bool Restriction::isSymbol(std::string input) {
-        for (std::string symbol : symbolVec) {
+        for (const std::string &symbol : symbolVec) {
             if (symbol == input) {
                 return true;
             } 
@@ -191,7 +204,7 @@ namespace LinearSystems {
 
         int j = 1;
 
-        if (restrictionInstance == nullptr) {
+        if (restrictionInstance.empty()) {
             return output;
         }
 
@@ -201,7 +214,7 @@ namespace LinearSystems {
                     continue;
             }
             if (i == variableNumber) { // Its a symbol
-                symbol = symbolMap[static_cast<int>(restrictionInstance[i].second.getValue())];
+                symbol = symbolToString(static_cast<int>(restrictionInstance[i].second.getValue()));
                 if (symbol.empty()) {
                     output += " symbol";
                 } else {
@@ -232,7 +245,7 @@ namespace LinearSystems {
     }
 
     void Restriction::displayRestriction() {
-        system(CLEAR_COMMAND);
+        Helper::clearScreen();
         std::cout << to_string(restrictionNumber) << std::endl;
     }
 
@@ -240,114 +253,33 @@ namespace LinearSystems {
         return restrictionInstance[variableNumber].second;
     }
 
-    void Restriction::addSlackVariable(std::vector<restrictionItem> &symbolVec, bool isFirst) {
+    void Restriction::addSlackVariable(const std::vector<restrictionItem> &columns) {
         /**
          * I have a given restriction
          * Rn = 1*x1 -4*x2 + 7*x3 <= 10
          * 
-         * And I have new slack variables x4, x5, x6, i want to insert them
+         * And I have new slack variables x4, x5, x6, with the value each one has here
+         * (0 for the ones of the other restrictions), i want to insert them
          */
-
-        // variableNumber + 1 is for the system without the slack variables
-
         int oldVariableNumber = variableNumber;
-        variableNumber += symbolVec.size();
+        variableNumber += columns.size();
 
-        restrictionItem * newRestrictionInstance = 
-            static_cast<restrictionItem *>(
-                malloc(sizeof(restrictionItem) * (variableNumber+2)));
-
-        bool isNotEqualSign = restrictionInstance[oldVariableNumber].second.getValue() != symbolEnum::EQUAL;
-        /**
-         * If the variable is below the oldVariable number, just copy
-         * 
-         * If it is above the oldVariable number and is not == to the new variableNumber (symbol index)
-         * 
-         * then insert symbolVec[i-oldVariableNumber] which is the 
-         * slack variable until the new symbol index
-         */
-        
-        // Each restrictions can have in maximum 2 slack (variables)
-        bool changeDone = false;
-
-        for (int i = 0; i < (variableNumber+2); ++i) {
-
-            bool isLastSlack = i == (variableNumber-1);
-            bool isNextM = symbolVec[i-oldVariableNumber + 1].second.getMvalue();
-
-            if (i < oldVariableNumber) {
-                newRestrictionInstance[i] = restrictionInstance[i];
-
-            } else if (i < variableNumber) {
-
-                // Is the first restriction of the system and iterator is on the first slack
-                if (((i-oldVariableNumber) == 0) && isFirst) {
-                    symbolVec[i-oldVariableNumber].second.setValue(1);
-                }
-
-                // Current value is the one with 1, ignore the ones with 0
-                // save it, set the next one to 1, zero out the current
-                double currentItem = symbolVec[i-oldVariableNumber].second.getValue();
-                double isMItem = symbolVec[i-oldVariableNumber].second.getMvalue();
-
-                if (currentItem == 1 && !changeDone) {
-                    changeDone = true;
-
-                    // values with M are isolated, so (0,1) became (1,1)
-                    if (isMItem) {
-                        // We want to save as (0,1) so it doesnt comes out as (1 -1M)*xn but -1M*xn
-                        symbolVec[i-oldVariableNumber].second.setValue(0);
-                        symbolVec[i-oldVariableNumber].second.setMValue(1);
-
-                    } else if (isNextM) {
-                        // A value right before the M is always negative, as the M value
-                        // exists to allow it to be < 0
-                        symbolVec[i-oldVariableNumber].second.setValue(-1);
-                    }
-
-                    // If it contains an = already, we don't save any with the value 1
-                    if (!isNotEqualSign) {
-                        symbolVec[i-oldVariableNumber].second.setValue(0);
-                        symbolVec[i-oldVariableNumber].second.setMValue(0);
-                    }
-
-                    newRestrictionInstance[i] = symbolVec[i-oldVariableNumber];
-
-                    // Set up next variable
-                    symbolVec[i-oldVariableNumber].second.setValue(0);
-
-                    // If its the last item skips this, avoid core dump and resets all items
-                    if (!isLastSlack) {
-                        symbolVec[i-oldVariableNumber + 1].second.setValue(1);
-                        // Some restrictions might have more than one artificial variable allowed
-                        // And the second is always an M item, there is NEVER an restriction with
-                        // Just a M item
-
-                        if (isNextM) {
-                            changeDone = false;
-                        }
-                    }
-
-                    // Revert M item for next restriction for any restriction with =
-                    if (!isNotEqualSign && isMItem) {
-                        symbolVec[i-oldVariableNumber].second.setMValue(1);
-                    }
-                }
-            } else {
-                // For each step after the end of symbolVec, we should target symbol and result from
-                // restrictionInstance (hence taking the size of artificial variables from i)
-                newRestrictionInstance[i] = restrictionInstance[i-symbolVec.size()];
+        std::vector<restrictionItem> newRestrictionInstance(variableNumber+2);
 
-                // Replace the symbol <= or >= with =
-                if (i == variableNumber && isNotEqualSign) {
-                    newRestrictionInstance[i].second.setValue(symbolEnum::EQUAL);
-                }
-            }
+        for (int i = 0; i < oldVariableNumber; ++i) {
+            newRestrictionInstance[i] = restrictionInstance[i];
         }
+        for (std::size_t k = 0; k < columns.size(); ++k) {
+            newRestrictionInstance[oldVariableNumber + k] = columns[k];
+        }
+        // Symbol and b, the symbol is now =
+        newRestrictionInstance[variableNumber] = restrictionInstance[oldVariableNumber];
+        newRestrictionInstance[variableNumber].second.setValue(symbolEnum::EQUAL);
+        newRestrictionInstance[variableNumber+1] = restrictionInstance[oldVariableNumber+1];
 
-        restrictionInstance = newRestrictionInstance;
+        restrictionInstance.swap(newRestrictionInstance);
     }
-    
+
     void Restriction::addArtificialVariableToObjective(std::vector<restrictionItem> &symbolVec) {
          /**
          * I have a given objective
@@ -358,9 +290,7 @@ namespace LinearSystems {
 
         int oldVariableNumber = variableNumber;
         variableNumber += symbolVec.size();
-        restrictionItem * newObjetiveInstance = 
-            static_cast<restrictionItem *>(
-                malloc(sizeof(restrictionItem) * (variableNumber+2)));
+        std::vector<restrictionItem> newObjetiveInstance(variableNumber+2);
         bool isNotEqualSign = restrictionInstance[oldVariableNumber].second.getValue() != symbolEnum::EQUAL;
 
         /**
@@ -399,7 +329,82 @@ namespace LinearSystems {
             }
         }
 
-        restrictionInstance = newObjetiveInstance;
+        restrictionInstance.swap(newObjetiveInstance);
+    }
+
+    void Restriction::removeVariables(const std::vector<bool> &removed) {
+        int kept = 0;
+        for (int i = 0; i < variableNumber; ++i) {
+            kept += removed[i] ? 0 : 1;
+        }
+
+        std::vector<restrictionItem> newRestrictionInstance(kept+2);
+
+        int next = 0;
+        for (int i = 0; i < variableNumber; ++i) {
+            if (!removed[i]) {
+                newRestrictionInstance[next++] = restrictionInstance[i];
+            }
+        }
+        // Symbol and b
+        newRestrictionInstance[next] = restrictionInstance[variableNumber];
+        newRestrictionInstance[next+1] = restrictionInstance[variableNumber+1];
+
+        restrictionInstance.swap(newRestrictionInstance);
+
+        if (!bounds.empty()) {
+            int next = 0;
+            for (int i = 0; i < static_cast<int>(bounds.size()) && i < variableNumber; ++i) {
+                if (!removed[i]) {
+                    bounds[next++] = bounds[i];
+                }
+            }
+            bounds.resize(next);
+        }
+        variableNumber = kept;
+    }
+
+    void Restriction::appendVariable(const restrictionItem &item) {
+        // Before the symbol and b
+        restrictionInstance.insert(restrictionInstance.begin() + variableNumber, item);
+        ++variableNumber;
+    }
+
+    void Restriction::setBounds(int variable, double lower, double upper) {
+        if (variable >= static_cast<int>(bounds.size())) {
+            // Variables past the last one set stay [0, infinite)
+            bounds.resize(std::max(variable+1, variableNumber), variableBounds{0, INFINITE_BOUND});
+        }
+        bounds[variable] = variableBounds{lower, upper};
+    }
+
+    variableBounds Restriction::getBounds(int variable) const {
+        if (variable < static_cast<int>(bounds.size())) {
+            return bounds[variable];
+        }
+        return variableBounds{0, INFINITE_BOUND};
+    }
+
+    bool Restriction::hasBounds() const {
+        for (const variableBounds &range : bounds) {
+            if (range.lower != 0 || range.upper != INFINITE_BOUND) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Restriction::hasNegativeLowerBounds() const {
+        for (const variableBounds &range : bounds) {
+            if (range.lower < 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Restriction::clearBounds() {
+        bounds.clear();
     }
 
-};
\ No newline at end of file
+};
@@ -11,18 +11,11 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
 #include <vector>
 #include "../Values/Number.hxx"
 
-#ifdef _WIN32
-#include <windows.h>
-#define CLEAR_COMMAND "cls"
-#else
-#include <cstdlib>
-#define CLEAR_COMMAND "clear"
-#endif
-
 namespace LinearSystems {
 
     /**
@@ -58,9 +51,19 @@ namespace LinearSystems {
         MAX
     } objType;
 
-    extern std::vector <std::string> symbolVec;
+    // Read only, so any number of threads can share them
+    extern const std::vector <std::string> symbolVec;
+
+    extern const std::map<int, std::string> symbolMap;
 
-    extern std::map<int, std::string> symbolMap;
+    // "<", ">", "<=", ">=" or "=", empty for anything else
+    std::string symbolToString(int symbol);
+
+    // Range a variable may take, lower <= x <= upper
+    struct variableBounds {
+        double lower;
+        double upper;
+    };
 
     class Restriction {
 
@@ -74,9 +77,12 @@ namespace LinearSystems {
 
             std::string askForInput(bool hasSymbol, std::string message);
 
-            restrictionItem * restrictionInstance;
+            std::vector<restrictionItem> restrictionInstance;
 
-            static bool isDouble(std::string input);
+            // One per variable once any is set, empty while all are [0, infinite)
+            std::vector<variableBounds> bounds;
+
+            static bool isDouble(std::string_view input);
 
             static bool isSymbol(std::string input);
 
@@ -92,21 +98,63 @@ namespace LinearSystems {
 
             Restriction(int variables, int restrictionNumber, objType type = NONE);
 
-            ~Restriction();
-
-            restrictionItem * getRestriction() { return restrictionInstance; }
+            /**
+             * Create a restriction from values already known, without asking anything
+             * For example:
+             *  coefficients {1, 2, 12}, symbol LOWER_EQUAL, rightSide 4
+             * should result in
+             *  1*x1 + 2*x2 + 12*x3 <= 4
+             * For an objective (type MIN or MAX) symbol and rightSide are ignored
+             */
+            Restriction(int restrictionNumber, const std::vector<Value::Number> &coefficients,
+                        symbolEnum symbol, Value::Number rightSide, objType type = NONE);
+
+            /**
+             * Create a restriction from its items as they are stored (variables, symbol and b),
+             * nothing is negated or changed, used to load saved systems
+             */
+            Restriction(int restrictionNumber, const std::vector<restrictionItem> &items, objType type = NONE);
+
+            restrictionItem * getRestriction() { return restrictionInstance.data(); }
             
             std::string to_string(int line = 0);
 
             int getRestrictionNumber() { return restrictionNumber; }
+
+            objType getObjectiveType() const { return objectiveType; }
             
-            int getVariableNumber() { return variableNumber; }
+            int getVariableNumber() const { return variableNumber; }
 
             Value::Number getRestrictionSymbol();
 
-            void addSlackVariable(std::vector<restrictionItem> &symbolVec, bool isFirst);
+            // New columns before the symbol, one value per column, and the symbol becomes =
+            void addSlackVariable(const std::vector<restrictionItem> &columns);
 
             void addArtificialVariableToObjective(std::vector<restrictionItem> &symbolVec);
+
+            // Drops the variables marked in removed (one per variable), symbol and b are kept
+            void removeVariables(const std::vector<bool> &removed);
+
+            // New last variable (before the symbol), a cut's slack variable for example
+            void appendVariable(const restrictionItem &item);
+
+            /**
+             * Bounds of the variables, only the objective keeps them (the restrictions of the system
+             * don't need a line for them): x >= 0 unless set, INFINITE_BOUND when there is no upper one
+             */
+            void setBounds(int variable, double lower, double upper);
+
+            variableBounds getBounds(int variable) const;
+
+            // Whether any variable has bounds other than [0, infinite)
+            bool hasBounds() const;
+
+            // Whether any variable may go below 0, only the table (moving the variable) takes those
+            bool hasNegativeLowerBounds() const;
+
+            void clearBounds();
+
+            static constexpr double INFINITE_BOUND = std::numeric_limits<double>::infinity();
     };
 
 };
\ No newline at end of file
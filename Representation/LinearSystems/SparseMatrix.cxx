@@ -0,0 +1,117 @@
+/**
+ * @file SparseMatrix.cxx
+ * @brief File implemented to define a compressed (CSC and CSR) sparse matrix
+ * @version 0.1
+ *
+ */
+
+#include "SparseMatrix.hxx"
+#include <algorithm>
+
+namespace LinearSystems {
+
+    SparseMatrix::SparseMatrix() : lines(0), columns(0) {
+        columnStart.assign(1, 0);
+        lineStart.assign(1, 0);
+    }
+
+    SparseMatrix::SparseMatrix(int lines, int columns) : lines(lines), columns(columns) {
+        columnStart.assign(columns+1, 0);
+        lineStart.assign(lines+1, 0);
+    }
+
+    void SparseMatrix::add(int line, int column, double value) {
+        if (value == 0) {
+            return;
+        }
+        pending.push_back(triplet{line, column, value});
+    }
+
+    int SparseMatrix::addColumn() {
+        return columns++;
+    }
+
+    void SparseMatrix::compress() {
+        // Keep what was already compressed
+        for (int j = 0; j < static_cast<int>(columnStart.size())-1; ++j) {
+            for (int k = columnStart[j]; k < columnStart[j+1]; ++k) {
+                pending.push_back(triplet{lineIndex[k], j, columnValues[k]});
+            }
+        }
+
+        // Column major order, then sum the repeated positions
+        std::sort(pending.begin(), pending.end(), [](const triplet &first, const triplet &second) {
+            return (first.column != second.column) ? first.column < second.column : first.line < second.line;
+        });
+
+        columnStart.assign(columns+1, 0);
+        lineIndex.clear();
+        columnValues.clear();
+        lineIndex.reserve(pending.size());
+        columnValues.reserve(pending.size());
+
+        for (std::size_t k = 0; k < pending.size(); ++k) {
+            double value = pending[k].value;
+            while (k+1 < pending.size() &&
+                   pending[k+1].column == pending[k].column && pending[k+1].line == pending[k].line) {
+                value += pending[++k].value;
+            }
+            if (value == 0) {
+                continue;
+            }
+            lineIndex.push_back(pending[k].line);
+            columnValues.push_back(value);
+            ++columnStart[pending[k].column+1];
+        }
+        for (int j = 0; j < columns; ++j) {
+            columnStart[j+1] += columnStart[j];
+        }
+        pending.clear();
+        pending.shrink_to_fit();
+
+        // CSR is the transpose, counting first then placing
+        lineStart.assign(lines+1, 0);
+        for (int line : lineIndex) {
+            ++lineStart[line+1];
+        }
+        for (int i = 0; i < lines; ++i) {
+            lineStart[i+1] += lineStart[i];
+        }
+        columnIndex.assign(lineIndex.size(), 0);
+        lineValues.assign(lineIndex.size(), 0);
+        std::vector<int> next(lineStart.begin(), lineStart.end()-1);
+        for (int j = 0; j < columns; ++j) {
+            for (int k = columnStart[j]; k < columnStart[j+1]; ++k) {
+                int position = next[lineIndex[k]]++;
+                columnIndex[position] = j;
+                lineValues[position] = columnValues[k];
+            }
+        }
+    }
+
+    double SparseMatrix::get(int line, int column) const {
+        auto begin = lineIndex.begin() + columnStart[column];
+        auto end = lineIndex.begin() + columnStart[column+1];
+        auto found = std::lower_bound(begin, end, line);
+        if (found == end || *found != line) {
+            return 0;
+        }
+        return columnValues[found - lineIndex.begin()];
+    }
+
+    double SparseMatrix::dotColumn(int column, const std::vector<double> &input) const {
+        double sum = 0;
+        for (int k = columnStart[column]; k < columnStart[column+1]; ++k) {
+            sum += input[lineIndex[k]]*columnValues[k];
+        }
+        return sum;
+    }
+
+    void SparseMatrix::scatterColumn(int column, std::vector<double> &output) const {
+        output.assign(lines, 0);
+        for (int k = columnStart[column]; k < columnStart[column+1]; ++k) {
+            output[lineIndex[k]] = columnValues[k];
+        }
+    }
+
+};
@@ -0,0 +1,92 @@
+/**
+ * @file SparseMatrix.hxx
+ * @brief Header file to define a compressed (CSC and CSR) sparse matrix
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace LinearSystems {
+
+    /**
+     * Matrix that only keeps its non zero values, stored twice:
+     *  - by column (CSC), to take the columns of the basis and the entering column
+     *  - by line (CSR), to go through a restriction
+     *
+     * Values are added as (line, column, value) and compress() builds both
+     *
+     * Example:
+     *      | 1 0 2 |
+     *      | 0 3 0 |
+     * CSC:
+     *      columnStart {0, 1, 2, 3}, lineIndex {0, 1, 0}, columnValues {1, 3, 2}
+     * CSR:
+     *      lineStart {0, 2, 3}, columnIndex {0, 2, 1}, lineValues {1, 2, 3}
+     */
+    class SparseMatrix {
+
+        public:
+
+            SparseMatrix();
+
+            SparseMatrix(int lines, int columns);
+
+            // Values at the same position are summed, zeros are dropped on compress()
+            void add(int line, int column, double value);
+
+            // Adds a new empty column at the end, returns its index
+            int addColumn();
+
+            void compress();
+
+            int getLines() const { return lines; }
+            int getColumns() const { return columns; }
+            int getNonZeros() const { return columnValues.size(); }
+
+            // CSC
+            int columnBegin(int column) const { return columnStart[column]; }
+            int columnEnd(int column) const { return columnStart[column+1]; }
+            int getLineIndex(int position) const { return lineIndex[position]; }
+            double getColumnValue(int position) const { return columnValues[position]; }
+
+            // CSR
+            int lineBegin(int line) const { return lineStart[line]; }
+            int lineEnd(int line) const { return lineStart[line+1]; }
+            int getColumnIndex(int position) const { return columnIndex[position]; }
+            double getLineValue(int position) const { return lineValues[position]; }
+
+            // Value at (line, column), zero if not stored
+            double get(int line, int column) const;
+
+            // sum of input[i]*A[i][column]
+            double dotColumn(int column, const std::vector<double> &input) const;
+
+            // output = column, as a dense vector
+            void scatterColumn(int column, std::vector<double> &output) const;
+
+        private:
+
+            struct triplet {
+                int line;
+                int column;
+                double value;
+            };
+
+            int lines;
+            int columns;
+
+            std::vector<triplet> pending;
+
+            std::vector<int> columnStart;
+            std::vector<int> lineIndex;
+            std::vector<double> columnValues;
+
+            std::vector<int> lineStart;
+            std::vector<int> columnIndex;
+            std::vector<double> lineValues;
+    };
+
+};
@@ -0,0 +1,76 @@
+/**
+ * @file SparseSystem.cxx
+ * @brief File implemented to define the sparse, equality form, representation of a linear system
+ * @version 0.1
+ *
+ */
+
+#include "SparseSystem.hxx"
+
+namespace LinearSystems {
+
+    SparseSystem::SparseSystem(System * system) : system(system) {
+        restrictionNumber = system->getNumberOfRestrictions();
+        originalVariables = system->getNumberOfVariables();
+        objectiveAction = system->getAction();
+
+        Restriction * restrictions = system->getRestrictions();
+        restrictionItem * objective = system->getObjective()->getRestriction();
+
+        matrix = SparseMatrix(restrictionNumber, originalVariables);
+        b.assign(restrictionNumber, 0);
+        initialBasis.assign(restrictionNumber, -1);
+        artificial.assign(originalVariables, false);
+
+        // The objective is always a maximization, minimizations come negated already
+        for (int j = 0; j < originalVariables; ++j) {
+            costs.push_back(objective[j].second);
+        }
+
+        for (int i = 0; i < restrictionNumber; ++i) {
+            restrictionItem * line = restrictions[i].getRestriction();
+            int symbol = static_cast<int>(line[originalVariables].second.getValue());
+            double rightSide = line[originalVariables+1].second.getValue();
+            double sign = 1;
+
+            if (rightSide < 0) {
+                sign = -1;
+                if (symbol == LOWER_EQUAL || symbol == LOWER) {
+                    symbol = HIGHER_EQUAL;
+                } else if (symbol == HIGHER_EQUAL || symbol == HIGHER) {
+                    symbol = LOWER_EQUAL;
+                }
+            }
+
+            for (int j = 0; j < originalVariables; ++j) {
+                matrix.add(i, j, sign*line[j].second.getValue());
+            }
+            b[i] = sign*rightSide;
+
+            if (symbol == LOWER_EQUAL || symbol == LOWER) {
+                int slack = addColumn(Value::Number(0), false);
+                matrix.add(i, slack, 1);
+                initialBasis[i] = slack;
+                continue;
+            }
+
+            if (symbol == HIGHER_EQUAL || symbol == HIGHER) {
+                int surplus = addColumn(Value::Number(0), false);
+                matrix.add(i, surplus, -1);
+            }
+
+            int artificialColumn = addColumn(Value::Number(0, -1), true);
+            matrix.add(i, artificialColumn, 1);
+            initialBasis[i] = artificialColumn;
+        }
+
+        matrix.compress();
+    }
+
+    int SparseSystem::addColumn(const Value::Number &cost, bool isArtificial) {
+        costs.push_back(cost);
+        artificial.push_back(isArtificial);
+        return matrix.addColumn();
+    }
+
+};
@@ -0,0 +1,71 @@
+/**
+ * @file SparseSystem.hxx
+ * @brief Header file to define the sparse, equality form, representation of a linear system
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include "System.hxx"
+#include "SparseMatrix.hxx"
+
+namespace LinearSystems {
+
+    /**
+     * A System already in equality form, as the solver engines want it:
+     *  <= gets a slack (starts in the basis)
+     *  >= gets a surplus and an artificial with -M on the objective (starts in the basis)
+     *  =  gets an artificial with -M on the objective (starts in the basis)
+     * Lines with a negative b are multiplied by -1 first
+     *
+     * Only the non zero coefficients are stored, each slack, surplus
+     * or artificial column being a single value
+     */
+    class SparseSystem {
+
+        public:
+
+            SparseSystem(System * system);
+
+            int getNumberOfRestrictions() const { return restrictionNumber; }
+
+            // Original variables plus slack, surplus and artificial ones
+            int getNumberOfVariables() const { return matrix.getColumns(); }
+
+            // Variables of the System, they come first
+            int getNumberOfOriginalVariables() const { return originalVariables; }
+
+            const SparseMatrix & getMatrix() const { return matrix; }
+            const std::vector<double> & getB() const { return b; }
+            const std::vector<Value::Number> & getCosts() const { return costs; }
+
+            bool isArtificial(int column) const { return artificial[column]; }
+
+            // initialBasis[i] is the column that starts as base variable of line i
+            const std::vector<int> & getInitialBasis() const { return initialBasis; }
+
+            objType getAction() const { return objectiveAction; }
+
+            System * getSystem() { return system; }
+
+        private:
+
+            int addColumn(const Value::Number &cost, bool isArtificial);
+
+            System * system;
+
+            int restrictionNumber;
+            int originalVariables;
+
+            objType objectiveAction;
+
+            SparseMatrix matrix;
+            std::vector<double> b;
+            std::vector<Value::Number> costs;
+            std::vector<bool> artificial;
+            std::vector<int> initialBasis;
+    };
+
+};
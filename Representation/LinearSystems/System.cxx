@@ -16,6 +16,7 @@
 #include <iostream>
 #include <cmath>
 #include <string>
+#include <algorithm>
 
 namespace LinearSystems {
 
@@ -51,26 +52,85 @@ namespace LinearSystems {
     }
 
     System::System() {
-        restrictions = static_cast<Restriction *>(malloc(sizeof(Restriction) * restrictionNumber));
-        if (restrictions == nullptr) {
-            std::cout << "Memory allocation error" << std::endl;
-            return;
-        }
-        
         // Vai pedir quantidade de restrições e variáveis
         getInputs();
 
         buildObjective();
 
+        restrictions.reserve(restrictionNumber);
         for (int i = 1; i <= restrictionNumber; ++i) {
-            restrictions[i-1] = Restriction(variables, i, objType::NONE);
+            restrictions.push_back(Restriction(variables, i, objType::NONE));
         }
     }
 
+    System::System(objType action, const Restriction &objectiveRestriction,
+                   const std::vector<Restriction> &restrictionList) :
+        restrictions(restrictionList), objectiveAction(action) {
+        restrictionNumber = restrictionList.size();
+        variables = objectiveRestriction.getVariableNumber();
+
+        objective = new Restriction(objectiveRestriction);
+    }
+
     System::~System() {
         delete objective;
     }
 
+    void System::addRestriction(const Restriction &restriction) {
+        restrictions.push_back(restriction);
+        ++restrictionNumber;
+    }
+
+    System * System::copy() {
+        std::vector<Restriction> restrictionList;
+        restrictionList.reserve(restrictionNumber);
+        for (int i = 0; i < restrictionNumber; ++i) {
+            restrictionItem * items = restrictions[i].getRestriction();
+            std::vector<restrictionItem> line(items, items + restrictions[i].getVariableNumber() + 2);
+            restrictionList.push_back(Restriction(restrictions[i].getRestrictionNumber(), line));
+        }
+        restrictionItem * items = objective->getRestriction();
+        std::vector<restrictionItem> line(items, items + objective->getVariableNumber() + 2);
+        Restriction objectiveRestriction(0, line, objective->getObjectiveType());
+        if (objective->hasBounds()) {
+            for (int j = 0; j < variables; ++j) {
+                variableBounds range = objective->getBounds(j);
+                objectiveRestriction.setBounds(j, range.lower, range.upper);
+            }
+        }
+        return new System(objectiveAction, objectiveRestriction, restrictionList);
+    }
+
+    void System::boundsToRestrictions() {
+        if (!objective->hasBounds()) {
+            objective->clearBounds();
+            return;
+        }
+        std::vector<Value::Number> line;
+        auto addLine = [&](symbolEnum symbol, double rightSide) {
+            addRestriction(Restriction(restrictionNumber+1, line, symbol, Value::Number(rightSide)));
+        };
+        for (int j = 0; j < variables; ++j) {
+            variableBounds range = objective->getBounds(j);
+            if (range.lower == 0 && range.upper == Restriction::INFINITE_BOUND) {
+                continue;
+            }
+            line.assign(variables, Value::Number(0));
+            line[j] = Value::Number(1);
+            if (range.lower == range.upper) {
+                addLine(EQUAL, range.lower);
+                continue;
+            }
+            if (range.lower > 0) {
+                addLine(HIGHER_EQUAL, range.lower);
+            }
+            if (range.upper != Restriction::INFINITE_BOUND) {
+                addLine(LOWER_EQUAL, range.upper);
+            }
+        }
+        objective->clearBounds();
+    }
+
     void System::buildObjective() {
         bool inputNotValid = true;
         std::string input;
@@ -95,6 +155,17 @@ namespace LinearSystems {
         for (int i = 0; i < restrictionNumber; ++i) {
             output += restrictions[i].to_string(line++) + "\n";
         }
+        for (int j = 0; j < variables && objective->hasBounds(); ++j) {
+            variableBounds range = objective->getBounds(j);
+            if (range.lower == 0 && range.upper == Restriction::INFINITE_BOUND) {
+                continue;
+            }
+            output += Value::Number(range.lower).to_string() + " <= x" + std::to_string(j+1);
+            if (range.upper != Restriction::INFINITE_BOUND) {
+                output += " <= " + Value::Number(range.upper).to_string();
+            }
+            output += "\n";
+        }
         return output;
     }
 
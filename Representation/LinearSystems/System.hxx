@@ -21,7 +21,7 @@ namespace LinearSystems {
 
         private:
 
-            Restriction * restrictions;
+            std::vector<Restriction> restrictions;
 
             Restriction * objective;
 
@@ -36,7 +36,18 @@ namespace LinearSystems {
         public:
 
             System();
+
+            /**
+             * Create a system from restrictions already built (read from a file for example),
+             * without asking anything
+             */
+            System(objType action, const Restriction &objectiveRestriction,
+                   const std::vector<Restriction> &restrictionList);
+
             ~System();
+
+            System(const System &) = delete;
+            System& operator=(const System &) = delete;
             
             int getNumberOfRestrictions() { return restrictionNumber; }
             int getNumberOfVariables() { return variables; }
@@ -46,12 +57,25 @@ namespace LinearSystems {
             int restrictionNumber;
             int variables;
 
-            Restriction * getRestrictions() { return restrictions; }
+            Restriction * getRestrictions() { return restrictions.data(); }
             Restriction * getObjective() { return objective; }
             objType getAction() { return objectiveAction; }
 
             void  setVariableNumber(int newVarNbr) { variables = newVarNbr; }
 
+            // One more restriction at the end, with the same variables as the others
+            void addRestriction(const Restriction &restriction);
+
+            // Another system with its own restrictions, solving it leaves this one as it is
+            System * copy();
+
+            /**
+             * Bounds of the variables (see Restriction::setBounds) as restrictions at the end:
+             * x >= l, x <= u, or x = v when fixed. For what only knows x >= 0, as the revised engine,
+             * so a negative l (see Restriction::hasNegativeLowerBounds) has to be turned down before
+             */
+            void boundsToRestrictions();
+
     };
 
 };
\ No newline at end of file
@@ -0,0 +1,457 @@
+/**
+ * @file LpReader.cxx
+ * @brief File implemented to define the reader of CPLEX LP model files
+ * @version 0.1
+ *
+ */
+
+#include "LpReader.hxx"
+#include <cctype>
+#include <cstring>
+
+namespace Readers {
+
+    namespace {
+
+        // Case insensitive comparison, keyword in lowercase
+        bool is(std::string_view word, std::string_view keyword) {
+            if (word.size() != keyword.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < word.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(word[i])) != keyword[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool isWordStart(char c) {
+            return std::isalpha(static_cast<unsigned char>(c)) || (c != '\0' && std::strchr("!\"#$%&()/,;?@_`'{}|~", c) != nullptr);
+        }
+
+        bool isWordChar(char c) {
+            return isWordStart(c) || c == '.' || std::isdigit(static_cast<unsigned char>(c));
+        }
+
+        bool isInfinity(std::string_view word) {
+            return is(word, "inf") || is(word, "infinity");
+        }
+
+    };
+
+    LpReader::LpReader() : position(0) {
+
+    }
+
+    LinearSystems::System * LpReader::read(const std::string &path, bool mapped) {
+        LineReader reader(path, mapped);
+        if (!reader.isOpen()) {
+            error = "Could not open " + path;
+            return nullptr;
+        }
+        return read(reader);
+    }
+
+    LinearSystems::System * LpReader::readText(std::string_view text) {
+        LineReader reader(text);
+        return read(reader);
+    }
+
+    LinearSystems::System * LpReader::read(LineReader &reader) {
+
+        std::string_view line;
+        while (reader.next(line)) {
+            // Tokens point into the lines, buffered ones have to be kept
+            if (!reader.isMapped()) {
+                lines.emplace_back(line);
+                line = lines.back();
+            }
+            if (!tokenize(line, reader.getLineNumber())) {
+                return nullptr;
+            }
+        }
+
+        section current = NO_SECTION;
+        position = 0;
+        while (position < tokens.size() && current != END) {
+            if (at(SECTION)) {
+                current = tokens[position++].newSection;
+                if (current == OBJECTIVE && !readObjective()) {
+                    return nullptr;
+                }
+                continue;
+            }
+
+            bool ok;
+            switch (current) {
+                case CONSTRAINTS:
+                    ok = readConstraint();
+                    break;
+                case BOUNDS:
+                    ok = readBound();
+                    break;
+                case GENERALS:
+                    ok = readInteger(false);
+                    break;
+                case BINARIES:
+                    ok = readInteger(true);
+                    break;
+                default:
+                    ok = fail("Expected an objective (Maximize/Minimize) first");
+            }
+            if (!ok) {
+                return nullptr;
+            }
+        }
+
+        return builder.build(error);
+    }
+
+    bool LpReader::tokenize(std::string_view line, int lineNumber) {
+        std::size_t first = tokens.size();
+        std::size_t i = 0;
+
+        while (i < line.size()) {
+            char c = line[i];
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                ++i;
+                continue;
+            }
+            if (c == '\\') {
+                // Comment until the end of the line
+                break;
+            }
+
+            token item = {WORD, std::string_view(), 0, LinearSystems::EQUAL, NO_SECTION, lineNumber};
+
+            if (c == '<' || c == '>' || c == '=') {
+                // <=, =<, <, >=, =>, > and =
+                std::size_t start = i++;
+                if (i < line.size() && (line[i] == '<' || line[i] == '>' || line[i] == '=')) {
+                    ++i;
+                }
+                item.kind = SYMBOL;
+                item.text = line.substr(start, i - start);
+                if (item.text.find('<') != std::string_view::npos) {
+                    item.symbol = LinearSystems::LOWER_EQUAL;
+                } else if (item.text.find('>') != std::string_view::npos) {
+                    item.symbol = LinearSystems::HIGHER_EQUAL;
+                } else {
+                    item.symbol = LinearSystems::EQUAL;
+                }
+            } else if (c == ':') {
+                item.kind = COLON;
+                ++i;
+            } else if (c == '+' || c == '-') {
+                item.kind = SIGN;
+                item.value = (c == '-') ? -1 : 1;
+                ++i;
+            } else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                       (c == '.' && i+1 < line.size() && std::isdigit(static_cast<unsigned char>(line[i+1])))) {
+                std::size_t start = i;
+                while (i < line.size() && (std::isdigit(static_cast<unsigned char>(line[i])) || line[i] == '.')) {
+                    ++i;
+                }
+                // Exponent only when digits follow, 2e would be 2 times e
+                if (i < line.size() && (line[i] == 'e' || line[i] == 'E')) {
+                    std::size_t exponent = i+1;
+                    if (exponent < line.size() && (line[exponent] == '+' || line[exponent] == '-')) {
+                        ++exponent;
+                    }
+                    if (exponent < line.size() && std::isdigit(static_cast<unsigned char>(line[exponent]))) {
+                        i = exponent;
+                        while (i < line.size() && std::isdigit(static_cast<unsigned char>(line[i]))) {
+                            ++i;
+                        }
+                    }
+                }
+                item.kind = NUMBER;
+                item.text = line.substr(start, i - start);
+                if (!toDouble(item.text, item.value)) {
+                    error = "Line " + std::to_string(lineNumber) + ": Invalid number " + std::string(item.text);
+                    return false;
+                }
+            } else if (isWordStart(c)) {
+                std::size_t start = i;
+                while (i < line.size() && isWordChar(line[i])) {
+                    ++i;
+                }
+                item.text = line.substr(start, i - start);
+            } else {
+                error = "Line " + std::to_string(lineNumber) + ": Unexpected character " + c +
+                        " (quadratic terms are not supported)";
+                return false;
+            }
+
+            tokens.push_back(item);
+        }
+
+        // Section keywords only count at the start of a line
+        if (tokens.size() > first && tokens[first].kind == WORD) {
+            std::string_view second = (tokens.size() > first+1 && tokens[first+1].kind == WORD) ?
+                                       tokens[first+1].text : std::string_view();
+            int used = 0;
+            section found = sectionFromWords(tokens[first].text, second, used);
+            if (used == -1) {
+                error = "Line " + std::to_string(lineNumber) + ": Section " + std::string(tokens[first].text) + " is not supported";
+                return false;
+            }
+            if (found != NO_SECTION) {
+                tokens[first].kind = SECTION;
+                tokens[first].newSection = found;
+                if (found == OBJECTIVE) {
+                    tokens[first].value = is(tokens[first].text.substr(0, 3), "max") ? 1 : -1;
+                }
+                tokens.erase(tokens.begin()+first+1, tokens.begin()+first+used);
+            }
+        }
+        return true;
+    }
+
+    LpReader::section LpReader::sectionFromWords(std::string_view name, std::string_view next, int &used) {
+        used = 1;
+
+        if (is(name, "maximize") || is(name, "maximum") || is(name, "max") ||
+            is(name, "minimize") || is(name, "minimum") || is(name, "min")) {
+            return OBJECTIVE;
+        }
+        if ((is(name, "subject") && is(next, "to")) || (is(name, "such") && is(next, "that"))) {
+            used = 2;
+            return CONSTRAINTS;
+        }
+        if (is(name, "st") || is(name, "s.t.") || is(name, "st.")) {
+            return CONSTRAINTS;
+        }
+        if (is(name, "bounds") || is(name, "bound")) {
+            return BOUNDS;
+        }
+        if (is(name, "generals") || is(name, "general") || is(name, "gen")) {
+            return GENERALS;
+        }
+        if (is(name, "binaries") || is(name, "binary") || is(name, "bin")) {
+            return BINARIES;
+        }
+        if (is(name, "end")) {
+            return END;
+        }
+        if (is(name, "semi-continuous") || is(name, "semis") || is(name, "semi") || is(name, "sos")) {
+            used = -1;
+        }
+        return NO_SECTION;
+    }
+
+    bool LpReader::readObjective() {
+        builder.setAction(tokens[position-1].value > 0 ? LinearSystems::MAX : LinearSystems::MIN);
+        if (position >= tokens.size() || at(SECTION)) {
+            // Empty objective
+            return true;
+        }
+
+        readLabel();
+        expression terms;
+        double constant = 0;
+        if (!readExpression(terms, constant)) {
+            return false;
+        }
+        for (const std::pair<int, double> &term : terms) {
+            builder.addObjective(term.first, term.second);
+        }
+        // The constant doesn't change the solution, it is left out
+        if (position < tokens.size() && !at(SECTION)) {
+            return fail("Unexpected " + std::string(tokens[position].text) + " in the objective");
+        }
+        return true;
+    }
+
+    bool LpReader::readConstraint() {
+        std::string_view name = readLabel();
+
+        // Ranged form, lower <= expression <= upper
+        double rangeValue = 0;
+        LinearSystems::symbolEnum rangeSymbol = LinearSystems::EQUAL;
+        bool ranged = false;
+        std::size_t start = position;
+        if (readValue(rangeValue) && at(SYMBOL)) {
+            ranged = true;
+            rangeSymbol = tokens[position++].symbol;
+        } else {
+            position = start;
+        }
+
+        expression terms;
+        double constant = 0;
+        if (!readExpression(terms, constant)) {
+            return false;
+        }
+        if (!at(SYMBOL)) {
+            return fail("Expected <=, >= or = in the constraint");
+        }
+        LinearSystems::symbolEnum symbol = tokens[position++].symbol;
+        double rightSide;
+        if (!readValue(rightSide)) {
+            return fail("Expected a number after the operator");
+        }
+
+        if (ranged && (rangeSymbol != symbol || symbol == LinearSystems::EQUAL)) {
+            return fail("A ranged constraint needs the same operator (<= or >=) on both sides");
+        }
+
+        int restriction = builder.addRestriction(name, symbol);
+        for (const std::pair<int, double> &term : terms) {
+            builder.addCoefficient(restriction, term.first, term.second);
+        }
+        builder.setRightSide(restriction, rightSide - constant);
+        if (ranged) {
+            builder.setRange(restriction, rightSide - rangeValue);
+        }
+        return true;
+    }
+
+    bool LpReader::readBound() {
+        double value;
+        std::size_t start = position;
+        if (readValue(value)) {
+            // value <= x [<= value]
+            if (!at(SYMBOL)) {
+                return fail("Expected an operator in the bound");
+            }
+            LinearSystems::symbolEnum symbol = tokens[position++].symbol;
+            if (!at(WORD)) {
+                return fail("Expected a variable in the bound");
+            }
+            int variable = builder.getVariable(tokens[position++].text);
+            if (symbol != LinearSystems::HIGHER_EQUAL) {
+                builder.setLowerBound(variable, value);
+            }
+            if (symbol != LinearSystems::LOWER_EQUAL) {
+                builder.setUpperBound(variable, value);
+            }
+            if (!at(SYMBOL)) {
+                return true;
+            }
+            symbol = tokens[position++].symbol;
+            if (!readValue(value)) {
+                return fail("Expected a number in the bound");
+            }
+            if (symbol != LinearSystems::HIGHER_EQUAL) {
+                builder.setUpperBound(variable, value);
+            }
+            if (symbol != LinearSystems::LOWER_EQUAL) {
+                builder.setLowerBound(variable, value);
+            }
+            return true;
+        }
+
+        position = start;
+        if (!at(WORD)) {
+            return fail("Expected a variable in the bound");
+        }
+        int variable = builder.getVariable(tokens[position++].text);
+        if (at(WORD) && is(tokens[position].text, "free")) {
+            ++position;
+            builder.setLowerBound(variable, -ModelBuilder::INFINITE);
+            return true;
+        }
+        if (!at(SYMBOL)) {
+            return fail("Expected an operator or free in the bound");
+        }
+        LinearSystems::symbolEnum symbol = tokens[position++].symbol;
+        if (!readValue(value)) {
+            return fail("Expected a number in the bound");
+        }
+        if (symbol != LinearSystems::HIGHER_EQUAL) {
+            builder.setUpperBound(variable, value);
+        }
+        if (symbol != LinearSystems::LOWER_EQUAL) {
+            builder.setLowerBound(variable, value);
+        }
+        return true;
+    }
+
+    bool LpReader::readInteger(bool binary) {
+        if (!at(WORD)) {
+            return fail("Expected a variable name");
+        }
+        // The relaxation is solved, generals are just continuous
+        int variable = builder.getVariable(tokens[position++].text);
+        if (binary) {
+            builder.setLowerBound(variable, 0);
+            builder.setUpperBound(variable, 1);
+        }
+        return true;
+    }
+
+    std::string_view LpReader::readLabel() {
+        if (at(WORD) && position+1 < tokens.size() && tokens[position+1].kind == COLON) {
+            std::string_view name = tokens[position].text;
+            position += 2;
+            return name;
+        }
+        return std::string_view();
+    }
+
+    bool LpReader::readExpression(expression &terms, double &constant) {
+        while (true) {
+            double sign = 1;
+            bool hasSign = false;
+            while (at(SIGN)) {
+                sign *= tokens[position++].value;
+                hasSign = true;
+            }
+
+            double coefficient = 1;
+            bool hasNumber = false;
+            if (at(NUMBER)) {
+                coefficient = tokens[position++].value;
+                hasNumber = true;
+            }
+
+            if (at(WORD) && !(position+1 < tokens.size() && tokens[position+1].kind == COLON)) {
+                int variable = builder.getVariable(tokens[position++].text);
+                terms.push_back(std::make_pair(variable, sign*coefficient));
+            } else if (hasNumber) {
+                constant += sign*coefficient;
+            } else if (hasSign || terms.empty()) {
+                return fail("Expected a term");
+            }
+
+            if (!at(SIGN)) {
+                return true;
+            }
+        }
+    }
+
+    bool LpReader::readValue(double &value) {
+        double sign = 1;
+        while (at(SIGN)) {
+            sign *= tokens[position++].value;
+        }
+        if (at(NUMBER)) {
+            value = sign*tokens[position++].value;
+            return true;
+        }
+        if (at(WORD) && isInfinity(tokens[position].text)) {
+            ++position;
+            value = sign*ModelBuilder::INFINITE;
+            return true;
+        }
+        return false;
+    }
+
+    bool LpReader::at(tokenKind kind) const {
+        return position < tokens.size() && tokens[position].kind == kind;
+    }
+
+    bool LpReader::fail(const std::string &message) {
+        int line = 0;
+        if (position < tokens.size()) {
+            line = tokens[position].line;
+        } else if (!tokens.empty()) {
+            line = tokens.back().line;
+        }
+        error = "Line " + std::to_string(line) + ": " + message;
+        return false;
+    }
+
+};
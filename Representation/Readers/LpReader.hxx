@@ -0,0 +1,120 @@
+/**
+ * @file LpReader.hxx
+ * @brief Header file to define the reader of CPLEX LP model files
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Reader.hxx"
+
+namespace Readers {
+
+    /**
+     * CPLEX LP file, for example:
+     *
+     * \ comment
+     * Maximize
+     *  obj: 3 x1 + 5 x2
+     * Subject To
+     *  c1: x1 <= 4
+     *  c2: 2 x2 <= 12
+     *  c3: 3 x1 + 2 x2 <= 18
+     * Bounds
+     *  x1 <= 10
+     *  0 <= x2 <= 20
+     * End
+     *
+     * Section keywords are case insensitive and start a line, everything else may span lines.
+     * Generals are read as continuous, binaries become 0 <= x <= 1
+     */
+    class LpReader {
+
+        public:
+
+            LpReader();
+
+            // nullptr if it failed, see getError()
+            LinearSystems::System * read(const std::string &path, bool mapped = true);
+
+            // Same, from the text of the model
+            LinearSystems::System * readText(std::string_view text);
+
+            std::string getError() { return error; }
+
+        private:
+
+            // Both of the above, once the lines can be read
+            LinearSystems::System * read(LineReader &reader);
+
+            enum section {
+                NO_SECTION,
+                OBJECTIVE,
+                CONSTRAINTS,
+                BOUNDS,
+                GENERALS,
+                BINARIES,
+                END
+            };
+
+            enum tokenKind {
+                WORD,
+                NUMBER,
+                SYMBOL,
+                COLON,
+                SIGN,
+                SECTION
+            };
+
+            struct token {
+                tokenKind kind;
+                std::string_view text;             // Points into the file (or lines)
+                double value;                      // NUMBER, or -1/+1 for SIGN
+                LinearSystems::symbolEnum symbol;  // SYMBOL
+                section newSection;                // SECTION
+                int line;
+            };
+
+            typedef std::vector< std::pair<int, double> > expression;
+
+            bool tokenize(std::string_view line, int lineNumber);
+
+            // Section keyword starting the line, NO_SECTION if there is none
+            section sectionFromWords(std::string_view name, std::string_view next, int &used);
+
+            bool readObjective();
+            bool readConstraint();
+            bool readBound();
+            bool readInteger(bool binary);
+
+            // Optional "name:" label
+            std::string_view readLabel();
+
+            // term (+/- term)*, terms are [number] variable or a lone number (added to constant)
+            bool readExpression(expression &terms, double &constant);
+
+            // Signed number or infinity
+            bool readValue(double &value);
+
+            bool at(tokenKind kind) const;
+
+            bool fail(const std::string &message);
+
+            ModelBuilder builder;
+
+            // Buffered lines the tokens point into, a mapped file needs none
+            std::deque<std::string> lines;
+
+            std::vector<token> tokens;
+            std::size_t position;
+
+            std::string error;
+    };
+
+};
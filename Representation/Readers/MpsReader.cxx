@@ -0,0 +1,276 @@
+/**
+ * @file MpsReader.cxx
+ * @brief File implemented to define the reader of MPS (free and fixed) model files
+ * @version 0.1
+ *
+ */
+
+#include "MpsReader.hxx"
+#include <cctype>
+
+namespace Readers {
+
+    MpsReader::MpsReader(bool fixedFormat) : fixedFormat(fixedFormat), lineNumber(0) {
+
+    }
+
+    LinearSystems::System * MpsReader::read(const std::string &path, bool mapped) {
+        LineReader reader(path, mapped);
+        if (!reader.isOpen()) {
+            error = "Could not open " + path;
+            return nullptr;
+        }
+        return read(reader);
+    }
+
+    LinearSystems::System * MpsReader::readText(std::string_view text) {
+        LineReader reader(text);
+        return read(reader);
+    }
+
+    LinearSystems::System * MpsReader::read(LineReader &reader) {
+
+        std::string_view line;
+        section current = NO_SECTION;
+        bool ok = true;
+
+        while (ok && reader.next(line)) {
+            lineNumber = reader.getLineNumber();
+            // Blank lines and comments
+            if (line.empty() || line[0] == '*') {
+                continue;
+            }
+
+            // Section names start on the first column, data lines don't
+            if (!std::isspace(static_cast<unsigned char>(line[0]))) {
+                split(line, tokens);
+                current = sectionFromName(tokens[0]);
+                if (current == NO_SECTION) {
+                    ok = fail("Unknown section " + std::string(tokens[0]));
+                } else if (current == OBJSENSE && tokens.size() > 1) {
+                    // Free MPS allows OBJSENSE MAX on the same line
+                    builder.setAction(tokens[1] == "MAX" || tokens[1] == "MAXIMIZE" ?
+                                      LinearSystems::MAX : LinearSystems::MIN);
+                } else if (current == ENDATA) {
+                    break;
+                }
+                continue;
+            }
+
+            fields(line, current, tokens);
+            if (tokens.empty()) {
+                continue;
+            }
+
+            switch (current) {
+                case ROWS:
+                    ok = readRows(tokens);
+                    break;
+                case COLUMNS:
+                    ok = readColumns(tokens);
+                    break;
+                case RHS:
+                    ok = readRightSide(tokens, false);
+                    break;
+                case RANGES:
+                    ok = readRightSide(tokens, true);
+                    break;
+                case BOUNDS:
+                    ok = readBounds(tokens);
+                    break;
+                case OBJSENSE:
+                    builder.setAction(tokens[0] == "MAX" || tokens[0] == "MAXIMIZE" ?
+                                      LinearSystems::MAX : LinearSystems::MIN);
+                    break;
+                default:
+                    ok = fail("Data outside of a section");
+            }
+        }
+
+        if (!ok) {
+            return nullptr;
+        }
+        return builder.build(error);
+    }
+
+    MpsReader::section MpsReader::sectionFromName(std::string_view name) {
+        if (name == "NAME") return NAME;
+        if (name == "ROWS") return ROWS;
+        if (name == "COLUMNS") return COLUMNS;
+        if (name == "RHS") return RHS;
+        if (name == "RANGES") return RANGES;
+        if (name == "BOUNDS") return BOUNDS;
+        if (name == "OBJSENSE") return OBJSENSE;
+        if (name == "ENDATA") return ENDATA;
+        return NO_SECTION;
+    }
+
+    void MpsReader::fields(std::string_view line, section current, std::vector<std::string_view> &output) {
+        if (!fixedFormat) {
+            split(line, output);
+            // Free MPS may leave the set name out, put an empty one back so both formats match
+            if ((current == RHS || current == RANGES) && (output.size() % 2) == 0) {
+                output.insert(output.begin(), std::string_view());
+            } else if (current == BOUNDS) {
+                bool noValue = output.size() >= 1 &&
+                    (output[0] == "FR" || output[0] == "MI" || output[0] == "PL" || output[0] == "BV");
+                if ((noValue && output.size() == 2) || (!noValue && output.size() == 3)) {
+                    output.insert(output.begin()+1, std::string_view());
+                }
+            }
+            return;
+        }
+
+        // Fixed positions, 1 based: 2-3, 5-12, 15-22, 25-36, 40-47, 50-61
+        static const int starts[] = {1, 4, 14, 24, 39, 49};
+        static const int sizes[] = {2, 8, 8, 12, 8, 12};
+        output.clear();
+        for (int k = 0; k < 6; ++k) {
+            std::string_view field;
+            if (starts[k] < static_cast<int>(line.size())) {
+                field = line.substr(starts[k], sizes[k]);
+            }
+            std::size_t first = field.find_first_not_of(' ');
+            std::size_t last = field.find_last_not_of(' ');
+            field = (first == std::string_view::npos) ? std::string_view() : field.substr(first, last - first + 1);
+            output.push_back(field);
+        }
+
+        // Same order as the free format: drop the type field where there is none
+        if (current == ROWS) {
+            output.resize(2);
+        } else if (current != BOUNDS) {
+            output.erase(output.begin());
+        } else {
+            output.resize(4);
+        }
+        while (!output.empty() && output.back().empty()) {
+            output.pop_back();
+        }
+    }
+
+    bool MpsReader::readRows(std::vector<std::string_view> &tokens) {
+        if (tokens.size() < 2) {
+            return fail("Expected a row type and name");
+        }
+        std::string_view type = tokens[0];
+        if (type == "N") {
+            // Only the first N row is the objective, the others are ignored
+            if (objectiveName.empty()) {
+                objectiveName = tokens[1];
+            }
+            return true;
+        }
+
+        LinearSystems::symbolEnum symbol;
+        if (type == "L") {
+            symbol = LinearSystems::LOWER_EQUAL;
+        } else if (type == "G") {
+            symbol = LinearSystems::HIGHER_EQUAL;
+        } else if (type == "E") {
+            symbol = LinearSystems::EQUAL;
+        } else {
+            return fail("Unknown row type " + std::string(type));
+        }
+        builder.addRestriction(tokens[1], symbol);
+        return true;
+    }
+
+    bool MpsReader::readColumns(std::vector<std::string_view> &tokens) {
+        // Integer markers, the relaxation is solved so they don't matter
+        if (tokens.size() >= 2 && tokens[1] == "'MARKER'") {
+            return true;
+        }
+        if (tokens.size() < 3 || (tokens.size() % 2) == 0) {
+            return fail("Expected a column name and row/value pairs");
+        }
+
+        int variable = builder.getVariable(tokens[0]);
+        for (std::size_t k = 1; k+1 < tokens.size(); k += 2) {
+            double value;
+            if (!toDouble(tokens[k+1], value)) {
+                return fail("Invalid number " + std::string(tokens[k+1]));
+            }
+            if (tokens[k] == objectiveName) {
+                builder.addObjective(variable, value);
+                continue;
+            }
+            int restriction = builder.findRestriction(tokens[k]);
+            if (restriction == -1) {
+                // Extra N rows are ignored, anything else is an error
+                continue;
+            }
+            builder.addCoefficient(restriction, variable, value);
+        }
+        return true;
+    }
+
+    bool MpsReader::readRightSide(std::vector<std::string_view> &tokens, bool isRange) {
+        // Set name, then row/value pairs
+        if (tokens.size() < 3) {
+            return fail("Expected row/value pairs");
+        }
+        for (std::size_t k = 1; k+1 < tokens.size(); k += 2) {
+            double value;
+            if (!toDouble(tokens[k+1], value)) {
+                return fail("Invalid number " + std::string(tokens[k+1]));
+            }
+            if (tokens[k] == objectiveName) {
+                // Objective constant, doesn't change the solution
+                continue;
+            }
+            int restriction = builder.findRestriction(tokens[k]);
+            if (restriction == -1) {
+                return fail("Unknown row " + std::string(tokens[k]));
+            }
+            if (isRange) {
+                builder.setRange(restriction, value);
+            } else {
+                builder.setRightSide(restriction, value);
+            }
+        }
+        return true;
+    }
+
+    bool MpsReader::readBounds(std::vector<std::string_view> &tokens) {
+        // Type, set name, column and value
+        if (tokens.size() < 3) {
+            return fail("Expected a bound type, set and column");
+        }
+        std::string_view type = tokens[0];
+        int variable = builder.findVariable(tokens[2]);
+        if (variable == -1) {
+            return fail("Unknown column " + std::string(tokens[2]));
+        }
+
+        double value = 0;
+        bool hasValue = tokens.size() >= 4 && toDouble(tokens[3], value);
+
+        if (type == "FR" || type == "MI") {
+            builder.setLowerBound(variable, -ModelBuilder::INFINITE);
+        } else if (type == "PL") {
+            builder.setUpperBound(variable, ModelBuilder::INFINITE);
+        } else if (type == "BV") {
+            builder.setLowerBound(variable, 0);
+            builder.setUpperBound(variable, 1);
+        } else if (!hasValue) {
+            return fail("Bound " + std::string(type) + " needs a value");
+        } else if (type == "UP" || type == "UI") {
+            builder.setUpperBound(variable, value);
+        } else if (type == "LO" || type == "LI") {
+            builder.setLowerBound(variable, value);
+        } else if (type == "FX") {
+            builder.setLowerBound(variable, value);
+            builder.setUpperBound(variable, value);
+        } else {
+            return fail("Unknown bound type " + std::string(type));
+        }
+        return true;
+    }
+
+    bool MpsReader::fail(const std::string &message) {
+        error = "Line " + std::to_string(lineNumber) + ": " + message;
+        return false;
+    }
+
+};
@@ -0,0 +1,95 @@
+/**
+ * @file MpsReader.hxx
+ * @brief Header file to define the reader of MPS (free and fixed) model files
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Reader.hxx"
+
+namespace Readers {
+
+    /**
+     * MPS file, for example:
+     *
+     * NAME          EXAMPLE
+     * ROWS
+     *  N  COST
+     *  L  LIM1
+     *  G  LIM2
+     * COLUMNS
+     *     X1        COST         1.0   LIM1         1.0
+     *     X2        COST         2.0   LIM2         1.0
+     * RHS
+     *     RHS       LIM1         4.0   LIM2         1.0
+     * BOUNDS
+     *  UP BND       X1           4.0
+     * ENDATA
+     *
+     * Free MPS splits the fields on blanks (set names on RHS, RANGES and BOUNDS may be left out),
+     * fixed MPS takes them from their columns (2-3, 5-12, 15-22, 25-36, 40-47, 50-61)
+     *
+     * MPS minimizes unless there is an OBJSENSE section saying MAX
+     */
+    class MpsReader {
+
+        public:
+
+            MpsReader(bool fixedFormat = false);
+
+            // nullptr if it failed, see getError()
+            LinearSystems::System * read(const std::string &path, bool mapped = true);
+
+            // Same, from the text of the model
+            LinearSystems::System * readText(std::string_view text);
+
+            std::string getError() { return error; }
+
+        private:
+
+            // Both of the above, once the lines can be read
+            LinearSystems::System * read(LineReader &reader);
+
+            enum section {
+                NO_SECTION,
+                NAME,
+                ROWS,
+                COLUMNS,
+                RHS,
+                RANGES,
+                BOUNDS,
+                OBJSENSE,
+                ENDATA
+            };
+
+            section sectionFromName(std::string_view name);
+
+            // Fields of a data line, fixed or free, in the fixed positions order
+            void fields(std::string_view line, section current, std::vector<std::string_view> &output);
+
+            bool readRows(std::vector<std::string_view> &tokens);
+            bool readColumns(std::vector<std::string_view> &tokens);
+            bool readRightSide(std::vector<std::string_view> &tokens, bool isRange);
+            bool readBounds(std::vector<std::string_view> &tokens);
+
+            bool fail(const std::string &message);
+
+            bool fixedFormat;
+
+            ModelBuilder builder;
+
+            std::string objectiveName;
+
+            int lineNumber;
+
+            std::string error;
+
+            std::vector<std::string_view> tokens;
+    };
+
+};
@@ -0,0 +1,338 @@
+/**
+ * @file Reader.cxx
+ * @brief File implemented to define what the model file readers share
+ * @version 0.1
+ *
+ */
+
+#include "Reader.hxx"
+#include "MpsReader.hxx"
+#include "LpReader.hxx"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+
+namespace Readers {
+
+    modelFormat formatFromPath(const std::string &path) {
+        std::string extension;
+        std::size_t dot = path.find_last_of('.');
+        if (dot != std::string::npos) {
+            extension = path.substr(dot+1);
+        }
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+
+        if (extension == "mps") {
+            return FREE_MPS;
+        } else if (extension == "lp") {
+            return CPLEX_LP;
+        }
+        return UNKNOWN_FORMAT;
+    }
+
+    LinearSystems::System * readModel(const std::string &path, modelFormat format, std::string &error,
+                                      bool mapped) {
+        switch (format) {
+            case FREE_MPS:
+            case FIXED_MPS: {
+                MpsReader reader(format == FIXED_MPS);
+                LinearSystems::System * system = reader.read(path, mapped);
+                error = reader.getError();
+                return system;
+            }
+            case CPLEX_LP: {
+                LpReader reader;
+                LinearSystems::System * system = reader.read(path, mapped);
+                error = reader.getError();
+                return system;
+            }
+            default:
+                error = "Unknown model format for " + path + " (expected .mps or .lp)";
+                return nullptr;
+        }
+    }
+
+    LinearSystems::System * readModelText(std::string_view text, modelFormat format, std::string &error) {
+        switch (format) {
+            case FREE_MPS:
+            case FIXED_MPS: {
+                MpsReader reader(format == FIXED_MPS);
+                LinearSystems::System * system = reader.readText(text);
+                error = reader.getError();
+                return system;
+            }
+            case CPLEX_LP: {
+                LpReader reader;
+                LinearSystems::System * system = reader.readText(text);
+                error = reader.getError();
+                return system;
+            }
+            default:
+                error = "Unknown model format";
+                return nullptr;
+        }
+    }
+
+    LineReader::LineReader(const std::string &path, bool mapped) :
+        file(nullptr), position(0), size(0), lineNumber(0) {
+        if (mapped) {
+            mapping.reset(new MappedFile(path));
+            if (mapping->isOpen()) {
+                memory = mapping->view();
+                return;
+            }
+            mapping.reset();
+        }
+        file = std::fopen(path.c_str(), "rb");
+        buffer.resize(BUFFER_SIZE);
+    }
+
+    LineReader::LineReader(std::string_view text) :
+        memory(text.data() == nullptr ? "" : text), file(nullptr), position(0), size(0), lineNumber(0) {
+
+    }
+
+    LineReader::~LineReader() {
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+    }
+
+    bool LineReader::fill() {
+        size = std::fread(buffer.data(), 1, buffer.size(), file);
+        position = 0;
+        return size > 0;
+    }
+
+    bool LineReader::next(std::string_view &line) {
+        if (isMapped()) {
+            const char * data = memory.data();
+            std::size_t dataSize = memory.size();
+            if (position >= dataSize) {
+                return false;
+            }
+            const char * begin = data + position;
+            const char * found = static_cast<const char *>(std::memchr(begin, '\n', dataSize - position));
+            const char * end = (found == nullptr) ? data + dataSize : found;
+            line = std::string_view(begin, end - begin);
+            position = (end - data) + 1;
+        } else {
+            if (file == nullptr) {
+                return false;
+            }
+
+            current.clear();
+            bool readAnything = false;
+            bool inBuffer = false;
+            while (true) {
+                if (position == size && !fill()) {
+                    break;
+                }
+                readAnything = true;
+                const char * begin = buffer.data() + position;
+                const char * end = buffer.data() + size;
+                const char * found = static_cast<const char *>(std::memchr(begin, '\n', end - begin));
+                if (found == nullptr) {
+                    // Line goes on in the next block
+                    current.append(begin, end);
+                    position = size;
+                    continue;
+                }
+                if (current.empty()) {
+                    // Whole line is in the block, no copy
+                    line = std::string_view(begin, found - begin);
+                    inBuffer = true;
+                } else {
+                    current.append(begin, found);
+                }
+                position = (found - buffer.data()) + 1;
+                break;
+            }
+
+            if (!readAnything) {
+                return false;
+            }
+            if (!inBuffer) {
+                line = current;
+            }
+        }
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        ++lineNumber;
+        return true;
+    }
+
+    ModelBuilder::ModelBuilder() : objectiveAction(LinearSystems::MIN) {
+
+    }
+
+    std::string_view ModelBuilder::keep(std::string_view name) {
+        names.emplace_back(name);
+        return names.back();
+    }
+
+    int ModelBuilder::getVariable(std::string_view name) {
+        auto found = variableIndex.find(name);
+        if (found != variableIndex.end()) {
+            return found->second;
+        }
+        int index = objective.size();
+        variableIndex.emplace(keep(name), index);
+        objective.push_back(0);
+        lower.push_back(0);
+        upper.push_back(INFINITE);
+        return index;
+    }
+
+    int ModelBuilder::findVariable(std::string_view name) const {
+        auto found = variableIndex.find(name);
+        return (found == variableIndex.end()) ? -1 : found->second;
+    }
+
+    int ModelBuilder::findRestriction(std::string_view name) const {
+        auto found = restrictionIndex.find(name);
+        return (found == restrictionIndex.end()) ? -1 : found->second;
+    }
+
+    int ModelBuilder::addRestriction(std::string_view name, LinearSystems::symbolEnum symbol) {
+        int index = symbols.size();
+        if (!name.empty()) {
+            restrictionIndex.emplace(keep(name), index);
+        }
+        symbols.push_back(symbol);
+        rightSides.push_back(0);
+        ranges.push_back(std::nan(""));
+        coefficients.emplace_back();
+        return index;
+    }
+
+    void ModelBuilder::addCoefficient(int restriction, int variable, double value) {
+        coefficients[restriction].push_back(std::make_pair(variable, value));
+    }
+
+    void ModelBuilder::addObjective(int variable, double value) {
+        objective[variable] += value;
+    }
+
+    void ModelBuilder::setRightSide(int restriction, double value) {
+        rightSides[restriction] = value;
+    }
+
+    void ModelBuilder::setRange(int restriction, double value) {
+        ranges[restriction] = value;
+    }
+
+    void ModelBuilder::setLowerBound(int variable, double value) {
+        lower[variable] = value;
+    }
+
+    void ModelBuilder::setUpperBound(int variable, double value) {
+        upper[variable] = value;
+    }
+
+    LinearSystems::System * ModelBuilder::build(std::string &error) {
+        int variables = objective.size();
+        if (variables == 0) {
+            error = "The model has no variables";
+            return nullptr;
+        }
+
+        std::vector<LinearSystems::Restriction> restrictions;
+        std::vector<Value::Number> line;
+
+        auto addLine = [&](LinearSystems::symbolEnum symbol, double rightSide) {
+            restrictions.push_back(LinearSystems::Restriction(
+                restrictions.size()+1, line, symbol, Value::Number(rightSide)));
+        };
+
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            // Dense from here on, see the class comment
+            line.assign(variables, Value::Number(0));
+            for (const std::pair<int, double> &item : coefficients[i]) {
+                line[item.first] = line[item.first] + item.second;
+            }
+
+            LinearSystems::symbolEnum symbol = symbols[i];
+            double rightSide = rightSides[i];
+            if (std::isnan(ranges[i])) {
+                addLine(symbol, rightSide);
+                continue;
+            }
+
+            // A range is a second restriction on the same line
+            double range = std::fabs(ranges[i]);
+            if (symbol == LinearSystems::LOWER_EQUAL) {
+                addLine(LinearSystems::LOWER_EQUAL, rightSide);
+                addLine(LinearSystems::HIGHER_EQUAL, rightSide - range);
+            } else if (symbol == LinearSystems::HIGHER_EQUAL) {
+                addLine(LinearSystems::HIGHER_EQUAL, rightSide);
+                addLine(LinearSystems::LOWER_EQUAL, rightSide + range);
+            } else if (ranges[i] >= 0) {
+                addLine(LinearSystems::HIGHER_EQUAL, rightSide);
+                addLine(LinearSystems::LOWER_EQUAL, rightSide + range);
+            } else {
+                addLine(LinearSystems::LOWER_EQUAL, rightSide);
+                addLine(LinearSystems::HIGHER_EQUAL, rightSide - range);
+            }
+        }
+
+        std::vector<Value::Number> objectiveLine(objective.begin(), objective.end());
+        LinearSystems::Restriction objectiveRestriction(0, objectiveLine, LinearSystems::EQUAL,
+                                                        Value::Number(0), objectiveAction);
+
+        // Bounds go with the variables, they take no restriction
+        for (int j = 0; j < variables; ++j) {
+            // A finite one moves the variable (see Table::applyBounds), -infinite can't
+            if (lower[j] == -INFINITE) {
+                error = "Variables with no lower bound (free, MI) are not supported";
+                return nullptr;
+            }
+            if (lower[j] != 0 || upper[j] != INFINITE) {
+                objectiveRestriction.setBounds(j, lower[j], upper[j]);
+            }
+        }
+
+        if (restrictions.empty() && !objectiveRestriction.hasBounds()) {
+            error = "The model has no restrictions";
+            return nullptr;
+        }
+        if (restrictions.empty() && objectiveRestriction.hasNegativeLowerBounds()) {
+            // The bounds would be its only lines, x >= 0 can't say x >= -5
+            error = "A model with only bounds can't have negative lower bounds";
+            return nullptr;
+        }
+
+        LinearSystems::System * system = new LinearSystems::System(objectiveAction, objectiveRestriction, restrictions);
+        if (restrictions.empty()) {
+            // The table needs at least one line
+            system->boundsToRestrictions();
+        }
+        return system;
+    }
+
+    void split(std::string_view line, std::vector<std::string_view> &tokens) {
+        tokens.clear();
+        std::size_t i = 0;
+        while (i < line.size()) {
+            while (i < line.size() && std::isspace(static_cast<unsigned char>(line[i]))) {
+                ++i;
+            }
+            std::size_t start = i;
+            while (i < line.size() && !std::isspace(static_cast<unsigned char>(line[i]))) {
+                ++i;
+            }
+            if (i > start) {
+                tokens.push_back(line.substr(start, i - start));
+            }
+        }
+    }
+
+    bool toDouble(std::string_view input, double &output) {
+        return Value::Number::parse(input, output);
+    }
+
+};
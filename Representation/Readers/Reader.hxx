@@ -0,0 +1,168 @@
+/**
+ * @file Reader.hxx
+ * @brief Header file to define what the model file readers share
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../LinearSystems/System.hxx"
+#include "../../Helpers/MappedFile.hxx"
+
+namespace Readers {
+
+    enum modelFormat {
+        FREE_MPS,
+        FIXED_MPS,
+        CPLEX_LP,
+        UNKNOWN_FORMAT
+    };
+
+    // .mps is free MPS, .lp is CPLEX LP
+    modelFormat formatFromPath(const std::string &path);
+
+    /**
+     * Reads the model in the given file, nullptr if it failed, with the reason in error
+     * mapped: mmap the file instead of reading it through a buffer
+     */
+    LinearSystems::System * readModel(const std::string &path, modelFormat format, std::string &error,
+                                      bool mapped = true);
+
+    // Same, from the text of a model already in memory (sent over a socket for example)
+    LinearSystems::System * readModelText(std::string_view text, modelFormat format, std::string &error);
+
+    /**
+     * Reads a file line by line, the lines are views so nothing is copied
+     *
+     * Mapped: the whole file is mmap'ed and the lines point into it, they stay
+     * valid while the reader exists. Files that can't be mapped (pipes) fall back to buffered
+     *
+     * Buffered: the file is read in big blocks, the line points into
+     * the reader and is only valid until the next call
+     *
+     * Text: the lines point into the text, as if it was a mapped file
+     */
+    class LineReader {
+
+        public:
+
+            static const std::size_t BUFFER_SIZE = 1 << 20;
+
+            LineReader(const std::string &path, bool mapped = true);
+
+            LineReader(std::string_view text);
+
+            ~LineReader();
+
+            bool isOpen() const { return file != nullptr || isMapped(); }
+
+            // The lines stay valid while the reader exists (mapped file or text)
+            bool isMapped() const { return memory.data() != nullptr; }
+
+            // Next line without the line break, false when the file is over
+            bool next(std::string_view &line);
+
+            int getLineNumber() const { return lineNumber; }
+
+        private:
+
+            bool fill();
+
+            // Mapped (or text)
+            std::unique_ptr<MappedFile> mapping;
+            std::string_view memory;
+
+            // Buffered
+            std::FILE * file;
+            std::vector<char> buffer;
+            std::string current;
+
+            std::size_t position;
+            std::size_t size;
+            int lineNumber;
+    };
+
+    /**
+     * Gathers the model while a file is parsed (names, coefficients, bounds)
+     * and turns it into a System at the end
+     *
+     * Variables are non negative in the System, the bounds go to its objective
+     * (see Restriction::setBounds) and take no restriction, unless there is no other one
+     *
+     * The coefficients are kept sparse while parsing, but the System is dense: every line holds
+     * every variable (24 bytes each), so rows x columns has to fit in memory. A 10000 x 10000 model
+     * is about 2.4 GB however few non zeros it has. That is the System the table engines take (their
+     * table is dense, and bigger, anyway), Presolve, Snapshot and the server cache work on, and the one
+     * the revised engine's SparseSystem is made from; a sparse System would have to change all of them
+     */
+    class ModelBuilder {
+
+        public:
+
+            ModelBuilder();
+
+            // Index of the variable, created on first use
+            int getVariable(std::string_view name);
+
+            // -1 if there is no such variable/restriction
+            int findVariable(std::string_view name) const;
+            int findRestriction(std::string_view name) const;
+
+            int addRestriction(std::string_view name, LinearSystems::symbolEnum symbol);
+
+            void addCoefficient(int restriction, int variable, double value);
+
+            void addObjective(int variable, double value);
+
+            void setRightSide(int restriction, double value);
+
+            // Turns restriction into rightSide <= ... <= rightSide + |range| (or the other way around)
+            void setRange(int restriction, double value);
+
+            void setLowerBound(int variable, double value);
+            void setUpperBound(int variable, double value);
+
+            void setAction(LinearSystems::objType action) { objectiveAction = action; }
+
+            LinearSystems::System * build(std::string &error);
+
+            static constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+        private:
+
+            // Copy of the name the index keys point to, deque so they don't move
+            std::string_view keep(std::string_view name);
+
+            LinearSystems::objType objectiveAction;
+
+            std::deque<std::string> names;
+            std::unordered_map<std::string_view, int> variableIndex;
+            std::unordered_map<std::string_view, int> restrictionIndex;
+
+            std::vector<double> objective;
+            std::vector<double> lower;
+            std::vector<double> upper;
+
+            std::vector<LinearSystems::symbolEnum> symbols;
+            std::vector<double> rightSides;
+            std::vector<double> ranges;
+            std::vector< std::vector< std::pair<int, double> > > coefficients;
+    };
+
+    // Splits on blanks, reusing the tokens vector, the tokens point into line
+    void split(std::string_view line, std::vector<std::string_view> &tokens);
+
+    // Whole string must be the number
+    bool toDouble(std::string_view input, double &output);
+
+};
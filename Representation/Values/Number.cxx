@@ -13,146 +13,46 @@
 #include <limits.h>
 #include <iomanip>
 #include <string>
+#include <charconv>
 #include <cmath>
 #include <iostream>
+#include <sstream>
 
 namespace Value {
 
-    Number::Number() {
-        value = 0;
-        Mvalue = 0;
-    }
-
     // We expect it to be checked before coming here
-    Number::Number(std::string input) {
-        value = std::stod(input);
-        Mvalue = 0;
-    }
-
-    Number::Number(double inputValue, double inputMvalue) {
-        value = inputValue;
-        Mvalue = inputMvalue;
-    }
-
-    Number::Number(double inputValue) {
-        value = inputValue;
-        Mvalue = 0;
-    }
-
-    Number::~Number() {
-        // Nothing lmao
-    }
-
-    Number& Number::operator=(Number input) {
-        value = input.getValue();
-        Mvalue = input.getMvalue();
-        return *this;
-    }
-
-    Number& Number::operator=(double input){
-        value = input;
-        Mvalue = 0;
-        return *this;
+    Number::Number(std::string_view input) : value(0), Mvalue(0) {
+        parse(input, value);
     }
 
     // This is to remove redundancy on creating restrictions
-    Number& Number::operator=(std::string input) {
-        value = std::stod(input);
+    Number& Number::operator=(std::string_view input) {
+        value = 0;
         Mvalue = 0;
+        parse(input, value);
         return *this;
     }
 
-    Number& Number::operator+(Number input) {
-        Number * result = new Number(0);
-        if (input.getValue() == INT_MAX) {
-            result->setValue(INT_MAX);
-        } else {
-            result->setValue(value + input.getValue());
-        }
-        result->setMValue(Mvalue + input.getMvalue());
-        return *result;
-    }
-
-    Number& Number::operator+(double input) {
-        value += input;
-        Mvalue += 0;
-        return *this;
-    }
-
-    Number& Number::operator-(Number input) {
-        Number * result = new Number(0);
-        if (input.getValue() == INT_MAX) {
-            result->setValue(-INT_MAX);
-        } else {
-            result->setValue(value + input.getValue());
-        }
-        result->setValue(value - input.getValue());
-        result->setMValue(Mvalue - input.getMvalue());
-        return *result;
-    }
-
-    Number& Number::operator-(double input) {
-        value -= input;
-        Mvalue -= 0;
-        return *this;
-    }
-
-    Number& Number::operator*(Number input) {
-        Number * result = new Number(0);
-         // No scenarios where it multiplies with M and M
-        result->setMValue(Mvalue*input.getValue() + input.getMvalue()*value); 
-        result->setValue(value*input.getValue());
-        return *result;
-    }
-
-    Number& Number::operator*(double input) {
-        Number * result = new Number(0);
-        result->setValue(value * input);
-        result->setMValue(Mvalue * input);
-        return *result;
-    }
-
-    Number& Number::operator/(Number input) {
-        Number * result = new Number();
-        // No scenarios where it divides by M too
-        // But some Number instances might just be normal ints
-        if (input.getValue() != 0) {
-            result->setValue(value / input.getValue());
-            result->setMValue(Mvalue / input.getValue());
-        } else {
-            result->setValue(value = INT_MAX);
+    bool Number::parse(std::string_view input, double &output) {
+        // from_chars doesn't take the + sign stod used to accept
+        if (!input.empty() && input.front() == '+') {
+            input.remove_prefix(1);
         }
-        return *result;
-    }
-
-    Number& Number::operator/(double input) {
-        Number * result = new Number(0);
-        if (input != 0) {
-            result->setValue(value / input);
-            result->setMValue(Mvalue / input);
-        } else {
-            result->setValue(INT_MAX);
+        if (input.empty()) {
+            return false;
         }
-        return *result;
+        std::from_chars_result result = std::from_chars(input.data(), input.data() + input.size(), output);
+        return result.ec == std::errc() && result.ptr == input.data() + input.size();
     }
 
-    Number& Number::operator+=(Number input) {
-        *this = *this + input;
-        return *this;
-    }
-
-    bool Number::operator==(Number input) {
+    bool Number::operator==(const Number &input) const {
         if (value == 0 && input.getValue() == 0) {
             return (Mvalue == input.getMvalue());
         }
         return (value == input.getValue());
     }
 
-    bool Number::operator==(double input) {
-        return (value == input);
-    }
-
-    bool Number::operator>(Number input) {
+    bool Number::operator>(const Number &input) const {
         /**
          * cases:
          * 1 + 0M
@@ -191,11 +91,7 @@ namespace Value {
         return false;
     }
 
-    bool Number::operator>(double input) {
-        return (value > input);
-    }
-
-    bool Number::operator<(Number input) {
+    bool Number::operator<(const Number &input) const {
         // std::cout   << "Value: " << value << std::endl
         //             << "MValue: " << Mvalue << std::endl
         //             << "input.Value: " << input.getValue() << std::endl
@@ -219,41 +115,21 @@ namespace Value {
         return (value < input.getValue());
     }
 
-    bool Number::operator<(double input) {
-        return (value < input);
-    }
-
-    bool Number::operator>=(Number input) {
+    bool Number::operator>=(const Number &input) const {
         if (value == 0 && input.getValue() == 0) {
             return (Mvalue >= input.getMvalue());
         }
         return (value >= input.getValue());
     }
 
-    bool Number::operator>=(double input) {
-        return (value >= input);
-    }
-
-    bool Number::operator<=(Number input) {
+    bool Number::operator<=(const Number &input) const {
         if (value == 0 && input.getValue() == 0) {
             return (Mvalue <= input.getMvalue());
         }
         return (value <= input.getValue());
     }
 
-    bool Number::operator<=(double input) {
-        return (value <= input);
-    }
-
-    bool Number::operator!=(Number input) {
-        return value != input.getValue();
-    }
-
-    bool Number::operator!=(double input) {
-        return value != input;
-    }
-
-    std::string Number::to_string() {
+    std::string Number::to_string() const {
         if (value == INT_MAX) {
             return "∞";
         } else if (value == INT_MAX) {
@@ -272,7 +148,7 @@ namespace Value {
         return "(" + roundValue(value) + symbol + roundValue(Mvalue) + "*M)";
     }
 
-    std::string Number::to_string_no_m() {
+    std::string Number::to_string_no_m() const {
         if (Mvalue == 0 && value == 0) {
             return "0";
         } else if (Mvalue == 0) {
@@ -283,13 +159,6 @@ namespace Value {
         return "";
     }
 
-    bool Number::hasBothValues() {
-        return (
-            value != 0 &&
-            Mvalue != 0
-        );
-    }
-
     std::string Number::roundValue(double input) {
         bool noDecimals = input == static_cast<int>(input);
         int precision = noDecimals ? 0 : 2;
@@ -4,18 +4,27 @@
  * @brief Header file to define the representation of a number
  * @version 0.1
  * @date 2023-06-21
- * 
+ *
  * @copyright Copyright (c) 2023
- * 
+ *
  */
 
 #pragma once
 
 #include <map>
 #include <vector>
+#include <string>
+#include <string_view>
+#include <limits.h>
 
 namespace Value {
 
+    /**
+     * A number is value + Mvalue*M, M being the "big M" of the method
+     *
+     * The arithmetic is done by value, inline, so no operation allocates:
+     * the tableau updates call these operators for every cell of every pivot
+     */
     class Number {
 
         private:
@@ -25,61 +34,82 @@ namespace Value {
 
         public:
 
-            Number();
-            Number(std::string input);
-            Number(double value, double Mvalue);
-            Number(double value);
-            ~Number();
-            
-            double getValue() { return value; }
-            double getMvalue() { return Mvalue; }
+            constexpr Number() : value(0), Mvalue(0) {}
+            Number(std::string_view input);
+            constexpr Number(double value, double Mvalue) : value(value), Mvalue(Mvalue) {}
+            constexpr Number(double value) : value(value), Mvalue(0) {}
+
+            constexpr double getValue() const { return value; }
+            constexpr double getMvalue() const { return Mvalue; }
 
             void setValue(double newValue) { value = newValue; }
             void setMValue(double newValue) { Mvalue = newValue; }
 
-            Number& operator=(Number input);
-            Number& operator=(double input);
-            Number& operator=(std::string input);
+            Number& operator=(const Number &input) = default;
+            Number& operator=(double input) { value = input; Mvalue = 0; return *this; }
+            Number& operator=(std::string_view input);
+
+            // Whole input must be the number, no copy or allocation (std::from_chars)
+            static bool parse(std::string_view input, double &output);
+
+            constexpr Number operator+(const Number &input) const {
+                // INT_MAX is how an infinite theta is represented, keep it infinite
+                return Number(
+                    (input.value == INT_MAX) ? INT_MAX : value + input.value,
+                    Mvalue + input.Mvalue);
+            }
+            constexpr Number operator+(double input) const { return Number(value + input, Mvalue); }
 
-            Number& operator+(Number input);
-            Number& operator+(double input);
+            constexpr Number operator-(const Number &input) const {
+                return Number(value - input.value, Mvalue - input.Mvalue);
+            }
+            constexpr Number operator-(double input) const { return Number(value - input, Mvalue); }
 
-            Number& operator-(Number input);
-            Number& operator-(double input);
+            constexpr Number operator*(const Number &input) const {
+                // No scenarios where it multiplies with M and M
+                return Number(value*input.value, Mvalue*input.value + input.Mvalue*value);
+            }
+            constexpr Number operator*(double input) const { return Number(value*input, Mvalue*input); }
 
-            Number& operator*(Number input);
-            Number& operator*(double input);
+            constexpr Number operator/(const Number &input) const {
+                // No scenarios where it divides by M too
+                // But some Number instances might just be normal ints
+                return (input.value != 0) ?
+                    Number(value/input.value, Mvalue/input.value) :
+                    Number(INT_MAX, 0);
+            }
+            constexpr Number operator/(double input) const {
+                return (input != 0) ? Number(value/input, Mvalue/input) : Number(INT_MAX, 0);
+            }
 
-            Number& operator/(Number input);
-            Number& operator/(double input);
+            Number& operator+=(const Number &input) { *this = *this + input; return *this; }
+            Number& operator-=(const Number &input) { *this = *this - input; return *this; }
 
-            Number& operator+=(Number input);
+            bool operator==(const Number &input) const;
+            bool operator==(double input) const { return (value == input); }
 
-            bool operator==(Number input);
-            bool operator==(double input);
+            bool operator>(const Number &input) const;
+            bool operator>(double input) const { return (value > input); }
 
-            bool operator>(Number input);
-            bool operator>(double input);
+            bool operator<(const Number &input) const;
+            bool operator<(double input) const { return (value < input); }
 
-            bool operator<(Number input);
-            bool operator<(double input);
+            bool operator>=(const Number &input) const;
+            bool operator>=(double input) const { return (value >= input); }
 
-            bool operator>=(Number input);
-            bool operator>=(double input);
+            bool operator<=(const Number &input) const;
+            bool operator<=(double input) const { return (value <= input); }
 
-            bool operator<=(Number input);
-            bool operator<=(double input);
+            bool operator!=(const Number &input) const { return value != input.value; }
+            bool operator!=(double input) const { return value != input; }
 
-            bool operator!=(Number input);
-            bool operator!=(double input);
+            std::string to_string() const;
 
-            std::string to_string();
+            std::string to_string_no_m() const;
 
-            std::string to_string_no_m();
-            
-            bool hasBothValues();
+            bool hasBothValues() const { return (value != 0 && Mvalue != 0); }
 
-            std::string roundValue(double input);
+            static std::string roundValue(double input);
     };
 
-};
\ No newline at end of file
+};
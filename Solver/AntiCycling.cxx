@@ -0,0 +1,64 @@
+/**
+ * @file AntiCycling.cxx
+ * @brief File implemented to implement the detection of cycling and stalling on degenerate systems
+ * @version 0.1
+ *
+ */
+
+#include "AntiCycling.hxx"
+#include <algorithm>
+#include <cmath>
+
+namespace Solver {
+
+    AntiCycling::AntiCycling() : hash(0), next(0), stalled(0), active(false), random(1) {}
+
+    void AntiCycling::start(const std::vector<int> &baseColumns) {
+        hash = 0;
+        for (int column : baseColumns) {
+            hash += mix(column);
+        }
+        recent.clear();
+        next = 0;
+        stalled = 0;
+    }
+
+    cycleEvent AntiCycling::record(int entering, int leaving, bool degenerate) {
+        hash += mix(entering) - mix(leaving);
+
+        bool repeated = std::find(recent.begin(), recent.end(), hash) != recent.end();
+        if (static_cast<int>(recent.size()) < WINDOW) {
+            recent.push_back(hash);
+        } else {
+            recent[next] = hash;
+            next = (next + 1) % WINDOW;
+        }
+
+        stalled = degenerate ? stalled + 1 : 0;
+
+        if (repeated) {
+            return REPEATED_BASIS;
+        } else if (stalled >= STALL_LIMIT) {
+            return STALLED;
+        }
+        return NO_CYCLE;
+    }
+
+    std::vector<double> AntiCycling::perturbation(const std::vector<double> &values) {
+        std::uniform_real_distribution<double> distribution(PERTURBATION, 2*PERTURBATION);
+        std::vector<double> result(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            result[i] = distribution(random)*std::max(1.0, std::fabs(values[i]));
+        }
+        return result;
+    }
+
+    std::uint64_t AntiCycling::mix(int column) {
+        // splitmix64, spreads close columns all over the hash
+        std::uint64_t value = static_cast<std::uint64_t>(column) + 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30))*0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27))*0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+};
@@ -0,0 +1,76 @@
+/**
+ * @file AntiCycling.hxx
+ * @brief File implemented to define the detection of cycling and stalling on degenerate systems
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace Solver {
+
+    enum cycleEvent {
+        NO_CYCLE,
+        STALLED,            // Too many degenerate pivots in a row
+        REPEATED_BASIS      // Back to one of the last bases, it's cycling
+    };
+
+    /**
+     * Watches the pivots of an engine:
+     *  - the basis is hashed (order free, so a pivot only adds and removes one column)
+     *    and compared with the last WINDOW ones
+     *  - the degenerate pivots in a row are counted
+     *
+     * When either goes off the engine perturbs the base values (each one gets a small
+     * positive value so there are no more ties) and moves to Bland's rule, which can't
+     * cycle. The perturbation is taken out once it's optimal.
+     * If it still repeats a basis after that the engine gives up with CYCLIC
+     */
+    class AntiCycling {
+
+        public:
+
+            AntiCycling();
+
+            // Starts over from this basis, baseColumns[i] being the column of line i
+            void start(const std::vector<int> &baseColumns);
+
+            // A pivot, entering column in and leaving column out
+            cycleEvent record(int entering, int leaving, bool degenerate);
+
+            // Random values in [PERTURBATION, 2 PERTURBATION], relative to each value
+            std::vector<double> perturbation(const std::vector<double> &values);
+
+            // Whether the perturbation and Bland's rule were already used
+            bool isActive() const { return active; }
+            void setActive(bool isActive) { active = isActive; }
+
+            static const int WINDOW = 64;
+            static const int STALL_LIMIT = 100;
+            static constexpr double PERTURBATION = 1e-7;
+
+            // What is left below this once the perturbation is taken out is just rounding
+            static constexpr double REMOVAL_TOLERANCE = 1e-6;
+
+        private:
+
+            static std::uint64_t mix(int column);
+
+            std::uint64_t hash;
+
+            // Ring of the last WINDOW hashes
+            std::vector<std::uint64_t> recent;
+            int next;
+
+            int stalled;
+            bool active;
+
+            // Fixed seed, the same system always gets the same perturbation
+            std::mt19937 random;
+    };
+
+};
@@ -0,0 +1,83 @@
+/**
+ * @file Basis.cxx
+ * @brief File implemented to implement the basis file, to start a new solve from a previous one
+ * @version 0.1
+ *
+ */
+
+#include "Basis.hxx"
+#include "../Helpers/Helper.hxx"
+#include <fstream>
+
+namespace Solver {
+
+    bool Basis::save(const std::string &path, const Table * table, std::string &error) {
+        const Tableau &tableau = table->getTable();
+        int restrictions = tableau.getRows()-1;
+        int variables = tableau.getColumns()-2;
+        const baseVariableItem * bases = table->getBaseVariables();
+
+        std::ofstream file(path);
+        if (!file) {
+            error = "Could not create " + path;
+            return false;
+        }
+        file << "BASIS " << restrictions << " " << variables << "\n";
+        for (int i = 0; i < restrictions; ++i) {
+            file << "x" << bases[i].index << "\n";
+        }
+        file << "END\n";
+        file.close();
+        if (!file) {
+            error = "Could not write " + path;
+            return false;
+        }
+        return true;
+    }
+
+    bool Basis::load(const std::string &path, int restrictions, int variables,
+                     std::vector<int> &columns, std::string &error) {
+        std::ifstream file(path);
+        if (!file) {
+            error = "Could not open " + path;
+            return false;
+        }
+        std::string word;
+        int savedRestrictions = 0;
+        int savedVariables = 0;
+        if (!(file >> word >> savedRestrictions >> savedVariables) || word != "BASIS") {
+            error = path + " is not a basis file";
+            return false;
+        }
+        if (savedRestrictions != restrictions || savedVariables != variables) {
+            error = "The basis is for " + std::to_string(savedRestrictions) + " restrictions and " +
+                    std::to_string(savedVariables) + " variables, the system has " +
+                    std::to_string(restrictions) + " and " + std::to_string(variables);
+            return false;
+        }
+
+        columns.clear();
+        while (file >> word && word != "END") {
+            int index = 0;
+            if (word.size() > 1 && word[0] == 'x') {
+                Helper::isAllDigits(word.substr(1), index);
+            }
+            if (index < 1 || index > variables) {
+                error = "Invalid base variable " + word;
+                return false;
+            }
+            columns.push_back(index-1);
+        }
+        if (word != "END") {
+            error = "The basis is truncated";
+            return false;
+        }
+        if (static_cast<int>(columns.size()) != restrictions) {
+            error = "The basis has " + std::to_string(columns.size()) + " base variables, " +
+                    std::to_string(restrictions) + " expected";
+            return false;
+        }
+        return true;
+    }
+
+};
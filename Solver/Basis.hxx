@@ -0,0 +1,42 @@
+/**
+ * @file Basis.hxx
+ * @brief File implemented to define the basis file, to start a new solve from a previous one
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "Table.hxx"
+
+namespace Solver {
+
+    /**
+     * Text file with the base variable of each line of a solved table:
+     *
+     *  BASIS 3 5        restrictions and variables (slack and artificial included)
+     *  x3               one base variable per line, in the order of the lines
+     *  x2
+     *  x5
+     *  END
+     *
+     * The variables are named as the table prints them, so it can be edited by hand
+     */
+    class Basis {
+
+        public:
+
+            // Base variables of the table as they are now
+            static bool save(const std::string &path, const Table * table, std::string &error);
+
+            /**
+             * Reads the columns (0 based) of the base variables, the file must be for a table
+             * of that many restrictions and variables. False if it isn't, with the reason in error
+             */
+            static bool load(const std::string &path, int restrictions, int variables,
+                             std::vector<int> &columns, std::string &error);
+    };
+
+};
@@ -0,0 +1,153 @@
+/**
+ * @file Batch.cxx
+ * @brief File implemented to implement the batch mode, many model files solved at the same time
+ * @version 0.1
+ *
+ */
+
+#include "Batch.hxx"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace Solver {
+
+    namespace {
+
+        // JSON has no inf or nan
+        std::string number(double value) {
+            if (!std::isfinite(value)) {
+                return "null";
+            }
+            char text[32];
+            std::snprintf(text, sizeof(text), "%.12g", value);
+            return text;
+        }
+
+        bool isModel(const std::filesystem::path &path) {
+            std::string extension = path.extension().string();
+            return extension == ".lp" || extension == ".mps";
+        }
+
+    };
+
+    Batch::Batch(int threads, engineType engine, pricingRule pricing, bool withValues) :
+        pool(threads), withValues(withValues) {
+        options.engine = engine;
+        options.pricing = pricing;
+    }
+
+    bool Batch::listModels(const std::string &path, std::vector<std::string> &models, std::string &error) {
+        std::error_code code;
+        if (std::filesystem::is_directory(path, code)) {
+            for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(path, code)) {
+                if (entry.is_regular_file() && isModel(entry.path())) {
+                    models.push_back(entry.path().string());
+                }
+            }
+            if (code) {
+                error = "could not list " + path + ": " + code.message();
+                return false;
+            }
+            std::sort(models.begin(), models.end());
+            return true;
+        }
+
+        std::ifstream manifest(path);
+        if (!manifest.is_open()) {
+            error = "could not open " + path;
+            return false;
+        }
+        std::filesystem::path directory = std::filesystem::path(path).parent_path();
+        std::string line;
+        while (std::getline(manifest, line)) {
+            std::size_t comment = line.find('#');
+            if (comment != std::string::npos) {
+                line.erase(comment);
+            }
+            std::size_t begin = line.find_first_not_of(" \t\r");
+            if (begin == std::string::npos) {
+                continue;
+            }
+            std::size_t end = line.find_last_not_of(" \t\r");
+            std::filesystem::path model(line.substr(begin, end - begin + 1));
+            models.push_back(model.is_absolute() ? model.string() : (directory / model).string());
+        }
+        return true;
+    }
+
+    int Batch::run(const std::vector<std::string> &models, std::ostream &output) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<int> solvedCount(pool.getThreadCount(), 0);
+        std::vector<int> failedCount(pool.getThreadCount(), 0);
+
+        pool.run(static_cast<int>(models.size()), [&](int thread, int index) {
+            std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            batchResult result{models[index], solve(models[index], options), 0};
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            ++(result.result.solution == WORK ? failedCount : solvedCount)[thread];
+            std::string line = to_json(result, withValues) + "\n";
+            std::lock_guard<std::mutex> lock(outputMutex);
+            output << line << std::flush;
+        });
+
+        int solved = 0;
+        int failed = 0;
+        for (int i = 0; i < pool.getThreadCount(); ++i) {
+            solved += solvedCount[i];
+            failed += failedCount[i];
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        output << "{\"models\": " << models.size() << ", \"solved\": " << solved << ", \"failed\": " << failed
+               << ", \"threads\": " << pool.getThreadCount() << ", \"steals\": " << pool.getSteals()
+               << ", \"seconds\": " << number(seconds) << "}" << std::endl;
+        return failed;
+    }
+
+    std::string Batch::escape(const std::string &input) {
+        std::string output;
+        for (char c : input) {
+            if (c == '"' || c == '\\') {
+                output += '\\';
+                output += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", c);
+                output += code;
+            } else {
+                output += c;
+            }
+        }
+        return output;
+    }
+
+    std::string Batch::to_json(const batchResult &result, bool withValues) {
+        const solveResult &solved = result.result;
+        std::string output = "{\"model\": \"" + escape(result.model) + "\"";
+        if (solved.solution == WORK) {
+            return output + ", \"status\": \"ERROR\", \"error\": \"" + escape(solved.error) + "\"}";
+        }
+        output += ", \"status\": \"" + to_string(solved.solution) + "\"";
+        if (!solved.error.empty()) {
+            output += ", \"error\": \"" + escape(solved.error) + "\"";
+        }
+        if (solved.isOptimal()) {
+            output += ", \"sense\": \"" + std::string(solved.isMinimum ? "min" : "max") + "\"";
+            output += ", \"objective\": " + number(solved.objective);
+        }
+        output += ", \"iterations\": " + std::to_string(solved.iterations);
+        output += ", \"seconds\": " + number(result.seconds);
+        if (withValues && !solved.values.empty()) {
+            output += ", \"values\": [";
+            for (std::size_t j = 0; j < solved.values.size(); ++j) {
+                output += (j ? ", " : "") + number(solved.values[j]);
+            }
+            output += "]";
+        }
+        return output + "}";
+    }
+
+};
@@ -0,0 +1,73 @@
+/**
+ * @file Batch.hxx
+ * @brief File implemented to define the batch mode, many model files solved at the same time
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Solve.hxx"
+#include "../Helpers/WorkStealingPool.hxx"
+
+namespace Solver {
+
+    // How one model of the batch ended
+    struct batchResult {
+        std::string model;
+        solveResult result;     // An error if the file couldn't be read
+        double seconds;         // Reading and solving
+    };
+
+    /**
+     * Solves independent models (see solve) on a WorkStealingPool, one model per task and each
+     * one on a single thread. Nothing is shared between the tasks but the output, which gets one
+     * whole line per model (JSON Lines) as soon as it's solved:
+     *
+     *  {"model": "a.lp", "status": "DONE", "objective": 36, "iterations": 3, "seconds": 0.0001}
+     *
+     * A number that isn't finite (a value of an unbounded solve for example) is written as null
+     * Lines come in the order the models finish, the last one is the summary of the batch
+     */
+    class Batch {
+
+        public:
+
+            /**
+             * threads: models solved at the same time
+             * withValues: also writes the value of every variable ("values": [...])
+             */
+            Batch(int threads = 1, engineType engine = TABLEAU, pricingRule pricing = DANTZIG,
+                  bool withValues = false);
+
+            /**
+             * Model files from a directory (every .lp and .mps in it, sorted by name) or from a
+             * manifest (one path per line, relative to the manifest, # starts a comment)
+             */
+            static bool listModels(const std::string &path, std::vector<std::string> &models, std::string &error);
+
+            // Solves all of them, returns how many couldn't be read
+            int run(const std::vector<std::string> &models, std::ostream &output);
+
+
+            static std::string to_json(const batchResult &result, bool withValues);
+
+            // Inside the quotes of a JSON string
+            static std::string escape(const std::string &input);
+
+        private:
+
+            WorkStealingPool pool;
+
+            solveOptions options;
+            bool withValues;
+
+            // Only the writing of a whole line is locked
+            std::mutex outputMutex;
+    };
+
+};
@@ -0,0 +1,150 @@
+/**
+ * @file DualSimplex.cxx
+ * @brief File implemented to implement the dual simplex, used to solve again after b changes or cuts
+ * @version 0.1
+ *
+ */
+
+#include "DualSimplex.hxx"
+#include <sstream>
+
+namespace Solver {
+
+    DualSimplex::DualSimplex(Table * table) : table(table), iterations(0) {}
+
+    bool DualSimplex::apply(const modification &change, std::string &error) {
+        int restrictions = table->getSystemToSolve()->getNumberOfRestrictions();
+        if (change.type == modification::RIGHT_SIDE) {
+            if (change.line < 0 || change.line >= restrictions) {
+                error = "there is no restriction " + std::to_string(change.line+1);
+                return false;
+            } else if (!table->changeRightSide(change.line, change.value)) {
+                error = "restriction " + std::to_string(change.line+1) + " has no slack variable to change b through";
+                return false;
+            }
+            return true;
+        }
+        if (!table->addCut(change.coefficients, change.symbol, change.value)) {
+            error = "a cut must be <= or >=";
+            return false;
+        }
+        return true;
+    }
+
+    status DualSimplex::iterate() {
+        table->calculateCjZj();
+        const Tableau &tableau = table->getTable();
+        int numRes = tableau.getRows()-1;
+        int numVar = tableau.getColumns()-2;
+
+        // 1 - Dual pricing, the base value furthest out of its bounds relative to the size of its line
+        const std::vector<double> &upper = table->getUpper();
+        const baseVariableItem * bases = table->getBaseVariables();
+        int line = -1;
+        double best = 0;
+        double infeasibility = 0;
+        bool aboveUpper = false;
+        for (int i = 0; i < numRes; ++i) {
+            const double * values = tableau.valueRow(i);
+            double bound = upper.empty() ? RatioTest::INFINITE : upper[bases[i].index-1];
+            double distance = 0;
+            bool above = values[numVar] > bound + ratioTest.getFeasibilityTolerance();
+            if (values[numVar] < -ratioTest.getFeasibilityTolerance()) {
+                distance = -values[numVar];
+            } else if (above) {
+                distance = values[numVar] - bound;
+            } else {
+                continue;
+            }
+            double norm = 0;
+            for (int j = 0; j < numVar; ++j) {
+                norm += values[j]*values[j];
+            }
+            double score = distance*distance/norm;
+            if (line == -1 || score > best) {
+                best = score;
+                line = i;
+                infeasibility = distance;
+                aboveUpper = above;
+            }
+        }
+        if (line == -1) {
+            return DONE;
+        }
+
+        // 2 - Dual ratio test, artificial columns never come back. A line above its upper bound and
+        // the columns at their upper bound are taken the other way around, as the ones at 0
+        const double * values = tableau.valueRow(line);
+        row.assign(values, values + numVar);
+        sign.assign(numVar, 1);
+        for (int j = 0; j < numVar; ++j) {
+            sign[j] = table->isAtUpper(j) ? -1 : 1;
+            row[j] *= aboveUpper ? -sign[j] : sign[j];
+        }
+        costs.assign(numVar, 0);
+        candidates.clear();
+        bool hasM = false;
+        for (int j : table->getNonBasic()) {
+            if (!table->isArtificialColumn(j)) {
+                candidates.push_back(j);
+                hasM = hasM || tableau.get(numRes, j).getMvalue() != 0;
+            }
+        }
+        // M dominates: only the columns without it, unless they can't enter
+        std::vector<int> withoutM;
+        for (int j : candidates) {
+            if (!hasM || tableau.get(numRes, j).getMvalue() == 0) {
+                withoutM.push_back(j);
+            }
+            costs[j] = sign[j]*tableau.get(numRes, j).getValue();
+        }
+        dualStep step = ratioTest.chooseDual(row, costs, withoutM, infeasibility, upper);
+        if (step.column == -1 && hasM) {
+            for (int j : candidates) {
+                costs[j] = sign[j]*tableau.get(numRes, j).getMvalue();
+            }
+            step = ratioTest.chooseDual(row, costs, candidates, infeasibility, upper);
+        }
+        if (step.column == -1) {
+            return NON_VIABLE;
+        }
+
+        // 3 - The boxed columns passed over go to their other bound, then the same pivot as the primal
+        for (int j : step.flips) {
+            table->flipBound(j);
+        }
+        table->setPivot(line, step.column, aboveUpper);
+        table->updateBaseVariables();
+        table->executeIterationChange();
+        ++iterations;
+        return WORK;
+    }
+
+    bool DualSimplex::parseCut(const std::string &input, modification &change) {
+        std::istringstream stream(input);
+        std::string word;
+        change.type = modification::CUT;
+        change.coefficients.clear();
+        bool hasSymbol = false;
+        bool hasValue = false;
+        while (stream >> word) {
+            double number;
+            if (!hasSymbol && (word == "<=" || word == ">=" || word == "<" || word == ">" || word == "=")) {
+                hasSymbol = true;
+                change.symbol = word == "<=" ? LinearSystems::LOWER_EQUAL :
+                                word == ">=" ? LinearSystems::HIGHER_EQUAL :
+                                word == "<"  ? LinearSystems::LOWER :
+                                word == ">"  ? LinearSystems::HIGHER : LinearSystems::EQUAL;
+            } else if (!Value::Number::parse(word, number) || hasValue) {
+                return false;
+            } else if (hasSymbol) {
+                change.value = number;
+                hasValue = true;
+            } else {
+                change.coefficients.push_back(number);
+            }
+        }
+        return hasSymbol && hasValue && !change.coefficients.empty();
+    }
+
+};
@@ -0,0 +1,81 @@
+/**
+ * @file DualSimplex.hxx
+ * @brief File implemented to define the dual simplex, used to solve again after b changes or cuts
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../Representation/LinearSystems/Restriction.hxx"
+#include "RatioTest.hxx"
+#include "Table.hxx"
+
+namespace Solver {
+
+    // A change to a solved system
+    struct modification {
+        enum kind {
+            RIGHT_SIDE,     // b of restriction line becomes value
+            CUT             // coefficients symbol value, as a new restriction
+        } type = RIGHT_SIDE;
+        int line = 0;
+        std::vector<double> coefficients;
+        LinearSystems::symbolEnum symbol = LinearSystems::LOWER_EQUAL;
+        double value = 0;
+    };
+
+    /**
+     * Dual simplex over a solved Table
+     *
+     * Changing b or adding a cut keeps (Cj - Zj) <= 0, so the base is still dual feasible,
+     * only some base values may be negative (or above their upper bound). Each iteration:
+     *  1 - Dual pricing: the line with the highest d_r^2 / |line r|^2 leaves, d_r being how far
+     *      its base value is out of its bounds
+     *  2 - Dual ratio test (see RatioTest::chooseDual) over that line picks the entering column
+     *  3 - Pivots as the primal does
+     * until every base value is >= 0, a few pivots from the old optimal in most cases
+     */
+    class DualSimplex {
+
+        public:
+
+            DualSimplex(Table * table);
+
+            // Applies a change to the table, false (with the reason in error) if it can't
+            bool apply(const modification &change, std::string &error);
+
+            /**
+             * Runs one iteration, returns:
+             *  WORK        - pivoted, not done yet
+             *  DONE        - every base value is >= 0, optimal again
+             *  NON_VIABLE  - the leaving line can't be fixed, the changed system has no solution
+             */
+            status iterate();
+
+            int getIterations() const { return iterations; }
+
+            /**
+             * Parses "1 0 2 <= 10" (coefficients, symbol and b, as the restrictions are typed in)
+             * False if it isn't one
+             */
+            static bool parseCut(const std::string &input, modification &change);
+
+        private:
+
+            Table * table;
+
+            RatioTest ratioTest;
+
+            int iterations;
+
+            // Reused every iteration
+            std::vector<double> row;
+            std::vector<double> costs;
+            std::vector<double> sign;
+            std::vector<int> candidates;
+    };
+
+};
@@ -0,0 +1,153 @@
+/**
+ * @file Factorization.cxx
+ * @brief File implemented to implement the factorization of the basis used by the revised simplex
+ * @version 0.1
+ *
+ */
+
+#include "Factorization.hxx"
+#include <cmath>
+#include <utility>
+
+namespace Solver {
+
+    Factorization::Factorization(int size, int refactorFrequency) :
+        size(size), refactorFrequency(refactorFrequency) {
+
+    }
+
+    bool Factorization::factorize(const std::vector< std::vector<double> > &columns) {
+        size = columns.size();
+        etas.clear();
+        lu.assign(static_cast<std::size_t>(size)*size, 0);
+        permutation.resize(size);
+
+        for (int j = 0; j < size; ++j) {
+            for (int i = 0; i < size; ++i) {
+                lu[static_cast<std::size_t>(i)*size + j] = columns[j][i];
+            }
+        }
+        for (int i = 0; i < size; ++i) {
+            permutation[i] = i;
+        }
+
+        // Gaussian elimination with partial pivoting
+        for (int k = 0; k < size; ++k) {
+            int best = k;
+            double bestValue = std::fabs(lu[static_cast<std::size_t>(k)*size + k]);
+            for (int i = k+1; i < size; ++i) {
+                double current = std::fabs(lu[static_cast<std::size_t>(i)*size + k]);
+                if (current > bestValue) {
+                    best = i;
+                    bestValue = current;
+                }
+            }
+            if (bestValue < PIVOT_TOLERANCE) {
+                return false;
+            }
+            if (best != k) {
+                for (int j = 0; j < size; ++j) {
+                    std::swap(lu[static_cast<std::size_t>(k)*size + j], lu[static_cast<std::size_t>(best)*size + j]);
+                }
+                std::swap(permutation[k], permutation[best]);
+            }
+
+            double * pivotLine = &lu[static_cast<std::size_t>(k)*size];
+            for (int i = k+1; i < size; ++i) {
+                double * line = &lu[static_cast<std::size_t>(i)*size];
+                if (line[k] == 0) {
+                    continue;
+                }
+                line[k] /= pivotLine[k];
+                double multiplier = line[k];
+                for (int j = k+1; j < size; ++j) {
+                    line[j] -= multiplier*pivotLine[j];
+                }
+            }
+        }
+        return true;
+    }
+
+    void Factorization::solve(std::vector<double> &input) const {
+        // P
+        std::vector<double> result(size);
+        for (int i = 0; i < size; ++i) {
+            result[i] = input[permutation[i]];
+        }
+        // L^-1
+        for (int i = 0; i < size; ++i) {
+            const double * line = &lu[static_cast<std::size_t>(i)*size];
+            double sum = result[i];
+            for (int j = 0; j < i; ++j) {
+                sum -= line[j]*result[j];
+            }
+            result[i] = sum;
+        }
+        // U^-1
+        for (int i = size-1; i >= 0; --i) {
+            const double * line = &lu[static_cast<std::size_t>(i)*size];
+            double sum = result[i];
+            for (int j = i+1; j < size; ++j) {
+                sum -= line[j]*result[j];
+            }
+            result[i] = sum/line[i];
+        }
+        // Etas, oldest first
+        for (const eta &current : etas) {
+            double pivotValue = result[current.pivotLine]/current.pivot;
+            result[current.pivotLine] = pivotValue;
+            if (pivotValue == 0) {
+                continue;
+            }
+            for (const std::pair<int, double> &value : current.values) {
+                result[value.first] -= value.second*pivotValue;
+            }
+        }
+        input.swap(result);
+    }
+
+    void Factorization::solveTransposed(std::vector<double> &input) const {
+        std::vector<double> result(input);
+        // Etas transposed, newest first
+        for (auto it = etas.rbegin(); it != etas.rend(); ++it) {
+            double sum = result[it->pivotLine];
+            for (const std::pair<int, double> &value : it->values) {
+                sum -= value.second*result[value.first];
+            }
+            result[it->pivotLine] = sum/it->pivot;
+        }
+        // U^-T
+        for (int i = 0; i < size; ++i) {
+            double sum = result[i];
+            for (int j = 0; j < i; ++j) {
+                sum -= lu[static_cast<std::size_t>(j)*size + i]*result[j];
+            }
+            result[i] = sum/lu[static_cast<std::size_t>(i)*size + i];
+        }
+        // L^-T
+        for (int i = size-1; i >= 0; --i) {
+            double sum = result[i];
+            for (int j = i+1; j < size; ++j) {
+                sum -= lu[static_cast<std::size_t>(j)*size + i]*result[j];
+            }
+            result[i] = sum;
+        }
+        // P^T
+        for (int i = 0; i < size; ++i) {
+            input[permutation[i]] = result[i];
+        }
+    }
+
+    void Factorization::update(const std::vector<double> &enteringColumn, int pivotLine) {
+        eta change;
+        change.pivotLine = pivotLine;
+        change.pivot = enteringColumn[pivotLine];
+        for (int i = 0; i < size; ++i) {
+            if (i != pivotLine && enteringColumn[i] != 0) {
+                change.values.push_back(std::make_pair(i, enteringColumn[i]));
+            }
+        }
+        etas.push_back(change);
+    }
+
+};
@@ -0,0 +1,80 @@
+/**
+ * @file Factorization.hxx
+ * @brief File implemented to define the factorization of the basis used by the revised simplex
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace Solver {
+
+    /**
+     * Keeps B^-1 implicitly as:
+     *  - an LU factorization (with partial pivoting) of the basis at the last refactorization
+     *  - a list of eta vectors (product form), one for each basis change after that
+     *
+     * So B^-1 = E_k ... E_1 U^-1 L^-1 P, and after refactorFrequency changes
+     * the basis is factorized again to drop the etas and the error they gather
+     */
+    class Factorization {
+
+        public:
+
+            Factorization(int size = 0, int refactorFrequency = 64);
+
+            /**
+             * Factorizes the basis, columns[i] being the column of the i-th base variable
+             * Returns false if the basis is singular
+             */
+            bool factorize(const std::vector< std::vector<double> > &columns);
+
+            /**
+             * Solves B x = input, in place (FTRAN)
+             */
+            void solve(std::vector<double> &input) const;
+
+            /**
+             * Solves B^T x = input, in place (BTRAN)
+             */
+            void solveTransposed(std::vector<double> &input) const;
+
+            /**
+             * The base variable of line pivotLine is replaced by a column whose
+             * FTRAN is enteringColumn (B^-1 a), adds the eta of that change
+             */
+            void update(const std::vector<double> &enteringColumn, int pivotLine);
+
+            // Whether enough etas were gathered to refactorize
+            bool needsRefactor() const { return static_cast<int>(etas.size()) >= refactorFrequency; }
+
+            int getRefactorFrequency() const { return refactorFrequency; }
+            void setRefactorFrequency(int frequency) { refactorFrequency = frequency; }
+
+            int getUpdates() const { return etas.size(); }
+
+            static constexpr double PIVOT_TOLERANCE = 1e-11;
+
+        private:
+
+            struct eta {
+                int pivotLine;
+                double pivot;
+                // Other lines of the column, (line, value)
+                std::vector< std::pair<int, double> > values;
+            };
+
+            int size;
+            int refactorFrequency;
+
+            // L (unit diagonal, below) and U (diagonal and above) in the same row-major matrix
+            std::vector<double> lu;
+            // permutation[i] is the original line now at line i
+            std::vector<int> permutation;
+
+            std::vector<eta> etas;
+    };
+
+};
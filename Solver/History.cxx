@@ -0,0 +1,217 @@
+/**
+ * @file History.cxx
+ * @brief File implemented to implement the history of the iterations of a table
+ * @version 0.1
+ *
+ */
+
+#include "History.hxx"
+#include "Kernels.hxx"
+#include "RatioTest.hxx"
+#include <algorithm>
+#include <cmath>
+
+namespace Solver {
+
+    namespace {
+
+        // b that moved more than this from what the pivot left is kept on the step
+        const double CHANGE_TOLERANCE = 1e-9;
+
+    };
+
+    History::History(int checkpointInterval, int checkpointCount) :
+        checkpointInterval(std::max(0, checkpointInterval)), checkpointCount(std::max(1, checkpointCount)),
+        first(0), rows(0), columns(0), phase(SINGLE_PHASE), ringNext(0) {
+
+    }
+
+    void History::clear() {
+        first = getSize();
+        steps.clear();
+        costs.clear();
+        ring.clear();
+        ringNext = 0;
+        expected.clear();
+        expectedBase.clear();
+        start = checkpoint();
+        rows = columns = 0;
+    }
+
+    int History::getCheckpointCount() const {
+        return (start.table.getRows() > 0 ? 1 : 0) + static_cast<int>(ring.size());
+    }
+
+    bool History::matches(Table &table) const {
+        const Tableau &current = table.getTable();
+        if (current.getRows() != rows || current.getColumns() != columns || table.getPhase() != phase) {
+            return false;
+        }
+        // Pivots it didn't record (the dual simplex after the perturbation) can't be done again
+        for (int i = 0; i < rows-1 && !expectedBase.empty(); ++i) {
+            if (table.getBaseVariables()[i].index-1 != expectedBase[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void History::restart(Table &table) {
+        clear();
+        const Tableau &current = table.getTable();
+        rows = current.getRows();
+        columns = current.getColumns();
+        phase = table.getPhase();
+        const LinearSystems::restrictionItem * objectives = table.getCosts();
+        for (int j = 0; j < columns-2; ++j) {
+            costs.push_back(objectives[j].second);
+        }
+        start = checkpoint{first, current, std::vector<int>()};
+    }
+
+    void History::record(Table &table) {
+        if (!matches(table)) {
+            restart(table);
+        }
+        const Tableau &current = table.getTable();
+        int numRes = rows-1;
+        int numVar = columns-2;
+        int iteration = getSize();
+
+        // A bound flip has no line
+        bool flip = table.isBoundFlip();
+        iterationDelta step;
+        step.line = flip ? -1 : table.getPivotLine();
+        step.entering = table.getPivotColumn();
+        step.leaving = flip ? -1 : table.getBaseVariables()[step.line].index-1;
+        step.pivot = flip ? 0 : current.valueRow(step.line)[step.entering];
+        step.objective = table.getObjectiveValue();
+
+        std::vector<int> base(numRes);
+        for (int i = 0; i < numRes; ++i) {
+            base[i] = table.getBaseVariables()[i].index-1;
+        }
+
+        // The pivots alone can't tell what the bounds or the perturbation did to b
+        for (int i = 0; i < numRes && !expected.empty(); ++i) {
+            double value = current.valueRow(i)[numVar];
+            if (std::fabs(value - expected[i]) > CHANGE_TOLERANCE*(1 + std::fabs(value))) {
+                step.rightSide.push_back(std::make_pair(i, value));
+            }
+        }
+
+        if (iteration == first) {
+            start.base = base;
+        } else if (checkpointInterval > 0 && (iteration - first) % checkpointInterval == 0) {
+            if (static_cast<int>(ring.size()) < checkpointCount) {
+                ring.push_back(checkpoint{iteration, current, base});
+            } else {
+                ring[ringNext] = checkpoint{iteration, current, base};
+                ringNext = (ringNext + 1) % checkpointCount;
+            }
+        }
+
+        // b after this pivot, if nothing else moves it
+        expected.resize(numRes);
+        for (int i = 0; i < numRes; ++i) {
+            expected[i] = current.valueRow(i)[numVar];
+        }
+        if (step.leaving != -1) {
+            double moved = expected[step.line]/step.pivot;
+            for (int i = 0; i < numRes; ++i) {
+                expected[i] -= current.valueRow(i)[step.entering]*moved;
+            }
+            expected[step.line] = moved;
+        }
+        expectedBase = base;
+        if (step.leaving != -1) {
+            expectedBase[step.line] = step.entering;
+        }
+
+        steps.push_back(std::move(step));
+    }
+
+    void History::replay(const iterationDelta &step, Tableau &table, std::vector<int> &base) {
+        if (step.leaving == -1) {
+            return;
+        }
+        int numRes = table.getRows()-1;
+        int size = table.getColumns()-1;
+        bool hasMPlane = table.hasMPlane();
+
+        // Same line operations as Table::executeIterationChange, so the same values
+        double * pivotValue = table.valueRow(step.line);
+        double * pivotMvalue = table.mRow(step.line);
+        double pivotElement = pivotValue[step.entering];
+        Kernels::divide(pivotValue, pivotElement, size);
+        if (hasMPlane) {
+            Kernels::divide(pivotMvalue, pivotElement, size);
+        }
+        for (int i = 0; i < numRes; ++i) {
+            if (i == step.line) continue;
+            double * lineValue = table.valueRow(i);
+            double * lineMvalue = table.mRow(i);
+            double equalizerValue = lineValue[step.entering];
+            double equalizerMvalue = hasMPlane ? lineMvalue[step.entering] : 0;
+            if (hasMPlane) {
+                Kernels::multiplySubtractPair(lineMvalue, pivotMvalue, equalizerValue,
+                                              pivotValue, equalizerMvalue, size);
+            }
+            Kernels::multiplySubtract(lineValue, pivotValue, equalizerValue, size);
+        }
+        base[step.line] = step.entering;
+    }
+
+    void History::fillCjZj(Tableau &table, const std::vector<int> &base) const {
+        int numRes = rows-1;
+        int numVar = columns-2;
+        for (int j = 0; j <= numVar; ++j) {
+            Value::Number z(0);
+            for (int i = 0; i < numRes; ++i) {
+                z = z + table.get(i, j)*costs[base[i]];
+            }
+            Value::Number value = j < numVar ? costs[j] - z : z;
+            // Same rounding calculateCjZj drops
+            double real = j < numVar && std::fabs(value.getValue()) < RatioTest::FEASIBILITY_TOLERANCE ? 0 : value.getValue();
+            double M = std::fabs(value.getMvalue()) < RatioTest::FEASIBILITY_TOLERANCE ? 0 : value.getMvalue();
+            table.set(numRes, j, Value::Number(real, M));
+        }
+    }
+
+    bool History::rebuild(int iteration, Tableau &table, std::vector<int> &base, std::string &error) const {
+        if (iteration < first || iteration >= getSize()) {
+            error = "iteration " + std::to_string(iteration) + " isn't kept, only " +
+                    std::to_string(first) + " to " + std::to_string(getSize()-1);
+            return false;
+        }
+
+        // Closest checkpoint at or before it
+        const checkpoint * from = &start;
+        for (const checkpoint &saved : ring) {
+            if (saved.iteration <= iteration && saved.iteration > from->iteration) {
+                from = &saved;
+            }
+        }
+        table = from->table;
+        base = from->base;
+
+        for (int k = from->iteration; k < iteration; ++k) {
+            replay(getStep(k), table, base);
+            for (const std::pair<int, double> &change : getStep(k+1).rightSide) {
+                table.valueRow(change.first)[columns-2] = change.second;
+            }
+        }
+
+        // The theta of the column that entered on it, as calculateTheta shows it
+        int numVar = columns-2;
+        int entering = getStep(iteration).entering;
+        for (int i = 0; i < rows-1; ++i) {
+            double column = table.valueRow(i)[entering];
+            table.set(i, numVar+1, column > RatioTest::PIVOT_TOLERANCE ?
+                                   Value::Number(table.valueRow(i)[numVar]/column) : Value::Number(0));
+        }
+        fillCjZj(table, base);
+        return true;
+    }
+
+};
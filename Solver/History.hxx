@@ -0,0 +1,128 @@
+/**
+ * @file History.hxx
+ * @brief File implemented to define the history of the iterations of a table
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Representation/Values/Number.hxx"
+#include "Tableau.hxx"
+#include "Table.hxx"
+
+namespace Solver {
+
+    /**
+     * What one iteration did, instead of the whole table
+     */
+    struct iterationDelta {
+        // -1 (and leaving -1, pivot 0) when the entering variable only went to its other bound
+        int line;
+        int entering;
+        int leaving;
+
+        double pivot;
+
+        // Before the pivot, as getResults would show it
+        Value::Number objective;
+
+        // b of the lines that didn't just follow the last pivot (bounds, perturbation), before this one
+        std::vector< std::pair<int, double> > rightSide;
+    };
+
+    /**
+     * Iterations of a table, kept as deltas, with whole tables (checkpoints) now and then
+     * so any of them can be rebuilt:
+     *  - the table of the first iteration is always kept
+     *  - every checkpointInterval iterations another one goes to a ring of checkpointCount,
+     *    so only the last ones are close to a checkpoint
+     * A past table is the closest checkpoint before it with the pivots after it done again
+     * (the same Kernels, so the same values as the table had)
+     *
+     * The history starts over when the table changes shape or phase (end of phase one),
+     * the costs and the columns of the tables before that are no longer the same, or when
+     * its base isn't the one the last pivot left (pivots done somewhere else)
+     */
+    class History {
+
+        public:
+
+            // checkpointInterval 0: only the first table, the rest is rebuilt from there
+            History(int checkpointInterval = 1000, int checkpointCount = 8);
+
+            /**
+             * The table about to pivot (after calculateTheta), once per iteration
+             * Iterations are numbered from 0, in the order they are recorded
+             */
+            void record(Table &table);
+
+            // Whether the table still has the shape, the phase and the base of the iterations kept
+            bool matches(Table &table) const;
+
+            // First iteration that can still be rebuilt
+            int getFirst() const { return first; }
+
+            // Iterations recorded, the first one included
+            int getSize() const { return first + static_cast<int>(steps.size()); }
+
+            const iterationDelta & getStep(int iteration) const { return steps[iteration - first]; }
+
+            /**
+             * The table (lines, b and Cj - Zj) and the base column of each line as they were
+             * when the iteration was recorded, before its pivot
+             * False if that iteration isn't there, with the reason in error
+             */
+            bool rebuild(int iteration, Tableau &table, std::vector<int> &base, std::string &error) const;
+
+            // Whole tables held now, the first one included
+            int getCheckpointCount() const;
+
+            void clear();
+
+        private:
+
+            struct checkpoint {
+                int iteration;
+                Tableau table;
+                std::vector<int> base;
+            };
+
+            // Starts over from this table
+            void restart(Table &table);
+
+            // Pivot of a recorded iteration on a rebuilt table
+            static void replay(const iterationDelta &step, Tableau &table, std::vector<int> &base);
+
+            // Cj - Zj line of a rebuilt table, as calculateCjZj does
+            void fillCjZj(Tableau &table, const std::vector<int> &base) const;
+
+            int checkpointInterval;
+            int checkpointCount;
+
+            int first;
+            std::vector<iterationDelta> steps;
+
+            // Shape and costs of the table since the last restart
+            int rows;
+            int columns;
+            phaseType phase;
+            std::vector<Value::Number> costs;
+
+            checkpoint start;
+
+            // Oldest one at ringNext once it's full
+            std::vector<checkpoint> ring;
+            int ringNext;
+
+            // b the lines should have after the last pivot, to find the ones that changed on their own
+            std::vector<double> expected;
+
+            // Base column of each line after the last pivot
+            std::vector<int> expectedBase;
+    };
+
+};
@@ -0,0 +1,230 @@
+/**
+ * @file Kernels.cxx
+ * @brief File implemented to implement the vectorized line operations used by the table
+ * @version 0.1
+ *
+ */
+
+#include "Kernels.hxx"
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace Solver {
+
+    namespace Kernels {
+
+        // Scalar versions, always available
+
+        static void multiplySubtractScalar(double * line, const double * pivotLine, double equalizer, int size) {
+            for (int j = 0; j < size; ++j) {
+                line[j] -= pivotLine[j]*equalizer;
+            }
+        }
+
+        static void multiplySubtractPairScalar(double * line,
+                                               const double * first, double firstEqualizer,
+                                               const double * second, double secondEqualizer,
+                                               int size) {
+            for (int j = 0; j < size; ++j) {
+                line[j] -= first[j]*firstEqualizer + second[j]*secondEqualizer;
+            }
+        }
+
+        static void divideScalar(double * line, double divisor, int size) {
+            for (int j = 0; j < size; ++j) {
+                line[j] = line[j]/divisor;
+            }
+        }
+
+#ifdef KERNELS_X86
+
+        // AVX2 versions, 4 doubles at a time with fused multiply-add
+
+        __attribute__((target("avx2,fma")))
+        static void multiplySubtractAvx2(double * line, const double * pivotLine, double equalizer, int size) {
+            __m256d factor = _mm256_set1_pd(equalizer);
+            int j = 0;
+            for (; j + 4 <= size; j += 4) {
+                __m256d current = _mm256_loadu_pd(line + j);
+                __m256d pivot = _mm256_loadu_pd(pivotLine + j);
+                // current - pivot*factor
+                _mm256_storeu_pd(line + j, _mm256_fnmadd_pd(pivot, factor, current));
+            }
+            multiplySubtractScalar(line + j, pivotLine + j, equalizer, size - j);
+        }
+
+        __attribute__((target("avx2,fma")))
+        static void multiplySubtractPairAvx2(double * line,
+                                             const double * first, double firstEqualizer,
+                                             const double * second, double secondEqualizer,
+                                             int size) {
+            __m256d firstFactor = _mm256_set1_pd(firstEqualizer);
+            __m256d secondFactor = _mm256_set1_pd(secondEqualizer);
+            int j = 0;
+            for (; j + 4 <= size; j += 4) {
+                __m256d product = _mm256_mul_pd(_mm256_loadu_pd(first + j), firstFactor);
+                product = _mm256_fmadd_pd(_mm256_loadu_pd(second + j), secondFactor, product);
+                _mm256_storeu_pd(line + j, _mm256_sub_pd(_mm256_loadu_pd(line + j), product));
+            }
+            multiplySubtractPairScalar(line + j, first + j, firstEqualizer,
+                                       second + j, secondEqualizer, size - j);
+        }
+
+        __attribute__((target("avx2")))
+        static void divideAvx2(double * line, double divisor, int size) {
+            __m256d factor = _mm256_set1_pd(divisor);
+            int j = 0;
+            for (; j + 4 <= size; j += 4) {
+                _mm256_storeu_pd(line + j, _mm256_div_pd(_mm256_loadu_pd(line + j), factor));
+            }
+            divideScalar(line + j, divisor, size - j);
+        }
+
+        // AVX-512 versions, 8 doubles at a time, the remainder goes with a mask
+
+        __attribute__((target("avx512f")))
+        static void multiplySubtractAvx512(double * line, const double * pivotLine, double equalizer, int size) {
+            __m512d factor = _mm512_set1_pd(equalizer);
+            int j = 0;
+            for (; j + 8 <= size; j += 8) {
+                __m512d current = _mm512_loadu_pd(line + j);
+                __m512d pivot = _mm512_loadu_pd(pivotLine + j);
+                _mm512_storeu_pd(line + j, _mm512_fnmadd_pd(pivot, factor, current));
+            }
+            if (j < size) {
+                __mmask8 mask = static_cast<__mmask8>((1u << (size - j)) - 1);
+                __m512d current = _mm512_maskz_loadu_pd(mask, line + j);
+                __m512d pivot = _mm512_maskz_loadu_pd(mask, pivotLine + j);
+                _mm512_mask_storeu_pd(line + j, mask, _mm512_fnmadd_pd(pivot, factor, current));
+            }
+        }
+
+        __attribute__((target("avx512f")))
+        static void multiplySubtractPairAvx512(double * line,
+                                               const double * first, double firstEqualizer,
+                                               const double * second, double secondEqualizer,
+                                               int size) {
+            __m512d firstFactor = _mm512_set1_pd(firstEqualizer);
+            __m512d secondFactor = _mm512_set1_pd(secondEqualizer);
+            int j = 0;
+            for (; j + 8 <= size; j += 8) {
+                __m512d product = _mm512_mul_pd(_mm512_loadu_pd(first + j), firstFactor);
+                product = _mm512_fmadd_pd(_mm512_loadu_pd(second + j), secondFactor, product);
+                _mm512_storeu_pd(line + j, _mm512_sub_pd(_mm512_loadu_pd(line + j), product));
+            }
+            if (j < size) {
+                __mmask8 mask = static_cast<__mmask8>((1u << (size - j)) - 1);
+                __m512d product = _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, first + j), firstFactor);
+                product = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, second + j), secondFactor, product);
+                _mm512_mask_storeu_pd(line + j, mask,
+                                      _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, line + j), product));
+            }
+        }
+
+        __attribute__((target("avx512f")))
+        static void divideAvx512(double * line, double divisor, int size) {
+            __m512d factor = _mm512_set1_pd(divisor);
+            int j = 0;
+            for (; j + 8 <= size; j += 8) {
+                _mm512_storeu_pd(line + j, _mm512_div_pd(_mm512_loadu_pd(line + j), factor));
+            }
+            divideScalar(line + j, divisor, size - j);
+        }
+
+#endif // KERNELS_X86
+
+        typedef void (*multiplySubtractFunction)(double *, const double *, double, int);
+        typedef void (*multiplySubtractPairFunction)(double *, const double *, double,
+                                                     const double *, double, int);
+        typedef void (*divideFunction)(double *, double, int);
+
+        static instructionSet supportedSet() {
+#ifdef KERNELS_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return AVX512;
+            } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return AVX2;
+            }
+#endif
+            return SCALAR;
+        }
+
+        struct dispatchTable {
+            instructionSet selected;
+            multiplySubtractFunction multiplySubtract;
+            multiplySubtractPairFunction multiplySubtractPair;
+            divideFunction divide;
+        };
+
+        static const dispatchTable SCALAR_TABLE = {SCALAR, multiplySubtractScalar, multiplySubtractPairScalar, divideScalar};
+#ifdef KERNELS_X86
+        static const dispatchTable AVX2_TABLE = {AVX2, multiplySubtractAvx2, multiplySubtractPairAvx2, divideAvx2};
+        static const dispatchTable AVX512_TABLE = {AVX512, multiplySubtractAvx512, multiplySubtractPairAvx512, divideAvx512};
+#endif
+
+        static const dispatchTable * tableOf(instructionSet selected) {
+            switch (selected) {
+#ifdef KERNELS_X86
+                case AVX512:
+                    return &AVX512_TABLE;
+                case AVX2:
+                    return &AVX2_TABLE;
+#endif
+                default:
+                    return &SCALAR_TABLE;
+            }
+        }
+
+        /**
+         * Decided on first use. The tables never change, only which one is in use, so a solve on
+         * another thread sees either the old set or the new one whole, never half of each
+         */
+        static std::atomic<const dispatchTable *> & dispatch() {
+            static std::atomic<const dispatchTable *> current(tableOf(supportedSet()));
+            return current;
+        }
+
+        void multiplySubtract(double * line, const double * pivotLine, double equalizer, int size) {
+            dispatch().load(std::memory_order_acquire)->multiplySubtract(line, pivotLine, equalizer, size);
+        }
+
+        void multiplySubtractPair(double * line,
+                                  const double * first, double firstEqualizer,
+                                  const double * second, double secondEqualizer,
+                                  int size) {
+            dispatch().load(std::memory_order_acquire)->multiplySubtractPair(line, first, firstEqualizer,
+                                                                              second, secondEqualizer, size);
+        }
+
+        void divide(double * line, double divisor, int size) {
+            dispatch().load(std::memory_order_acquire)->divide(line, divisor, size);
+        }
+
+        instructionSet getInstructionSet() {
+            return dispatch().load(std::memory_order_acquire)->selected;
+        }
+
+        void setInstructionSet(instructionSet selected) {
+            // Never go above what the processor has
+            if (selected > supportedSet()) {
+                selected = supportedSet();
+            }
+            dispatch().store(tableOf(selected), std::memory_order_release);
+        }
+
+        const char * to_string(instructionSet selected) {
+            switch (selected) {
+                case AVX512: return "AVX512";
+                case AVX2: return "AVX2";
+                default: return "SCALAR";
+            }
+        }
+
+    };
+
+};
@@ -0,0 +1,57 @@
+/**
+ * @file Kernels.hxx
+ * @brief File implemented to define the vectorized line operations used by the table
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+namespace Solver {
+
+    /**
+     * Line operations of the pivot (row elimination) over one plane of the Tableau
+     *
+     * Each one has a scalar version, an AVX2 version and an AVX-512 version,
+     * the best one the processor supports is chosen the first time they are called
+     */
+    namespace Kernels {
+
+        enum instructionSet {
+            SCALAR,
+            AVX2,
+            AVX512
+        };
+
+        /**
+         * line[j] = line[j] - pivotLine[j]*equalizer, for j in [0, size)
+         */
+        void multiplySubtract(double * line, const double * pivotLine, double equalizer, int size);
+
+        /**
+         * line[j] = line[j] - (first[j]*firstEqualizer + second[j]*secondEqualizer), for j in [0, size)
+         *
+         * This is the M part of Number line - pivotLine*equalizer:
+         * first is the pivot line M plane and second is its real plane
+         */
+        void multiplySubtractPair(double * line,
+                                  const double * first, double firstEqualizer,
+                                  const double * second, double secondEqualizer,
+                                  int size);
+
+        /**
+         * line[j] = line[j]/divisor, for j in [0, size)
+         */
+        void divide(double * line, double divisor, int size);
+
+        instructionSet getInstructionSet();
+
+        // Forces a given instruction set (if supported), mostly for comparing them. Safe while other
+        // threads solve, they just move to the new one on their next call
+        void setInstructionSet(instructionSet selected);
+
+        const char * to_string(instructionSet selected);
+
+    };
+
+};
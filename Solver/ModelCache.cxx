@@ -0,0 +1,66 @@
+/**
+ * @file ModelCache.cxx
+ * @brief File implemented to implement the cache of parsed models kept by the server
+ * @version 0.1
+ *
+ */
+
+#include "ModelCache.hxx"
+#include <algorithm>
+
+namespace Solver {
+
+    ModelCache::ModelCache(int capacity) : capacity(std::max(1, capacity)), hits(0), misses(0) {
+
+    }
+
+    std::uint64_t ModelCache::hash(std::string_view text) {
+        std::uint64_t value = 14695981039346656037ull;
+        for (char c : text) {
+            value ^= static_cast<unsigned char>(c);
+            value *= 1099511628211ull;
+        }
+        return value;
+    }
+
+    std::shared_ptr<cachedModel> ModelCache::find(std::uint64_t hash) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = index.find(hash);
+        if (found == index.end()) {
+            ++misses;
+            return nullptr;
+        }
+        ++hits;
+        order.splice(order.begin(), order, found->second);
+        return order.front();
+    }
+
+    std::shared_ptr<cachedModel> ModelCache::insert(std::uint64_t hash, LinearSystems::System * system) {
+        std::shared_ptr<cachedModel> model(new cachedModel{hash, system, std::vector<int>()});
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = index.find(hash);
+        if (found != index.end()) {
+            order.splice(order.begin(), order, found->second);
+            return order.front();
+        }
+        order.push_front(model);
+        index[hash] = order.begin();
+        if (static_cast<int>(order.size()) > capacity) {
+            // Deleted once the last request using it is over
+            index.erase(order.back()->hash);
+            order.pop_back();
+        }
+        return model;
+    }
+
+    std::vector<int> ModelCache::getBasis(const cachedModel &model) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return model.basis;
+    }
+
+    void ModelCache::setBasis(cachedModel &model, const std::vector<int> &basis) {
+        std::lock_guard<std::mutex> lock(mutex);
+        model.basis = basis;
+    }
+
+};
@@ -0,0 +1,82 @@
+/**
+ * @file ModelCache.hxx
+ * @brief File implemented to define the cache of parsed models kept by the server
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../Representation/LinearSystems/System.hxx"
+
+namespace Solver {
+
+    /**
+     * A model as it was parsed, with the basis its last optimal solve ended on
+     * The system is never solved itself (see System::copy), so any number of threads can copy it
+     */
+    struct cachedModel {
+        std::uint64_t hash;
+        LinearSystems::System * system;
+
+        // Only through the cache, it's shared between the threads
+        std::vector<int> basis;
+
+        ~cachedModel() { delete system; }
+    };
+
+    /**
+     * Least recently used models, keyed by the hash of their text (see hash)
+     * Every call locks the whole cache, the models themselves aren't locked
+     */
+    class ModelCache {
+
+        public:
+
+            // At most capacity models, the least recently used one goes first
+            ModelCache(int capacity);
+
+            ModelCache(const ModelCache &) = delete;
+            ModelCache& operator=(const ModelCache &) = delete;
+
+            // FNV-1a 64 of the text
+            static std::uint64_t hash(std::string_view text);
+
+            // nullptr if it isn't cached, otherwise it becomes the most recently used one
+            std::shared_ptr<cachedModel> find(std::uint64_t hash);
+
+            /**
+             * Takes the system (the cache deletes it), the one already there wins if
+             * two threads parsed the same model at the same time
+             */
+            std::shared_ptr<cachedModel> insert(std::uint64_t hash, LinearSystems::System * system);
+
+            std::vector<int> getBasis(const cachedModel &model);
+
+            void setBasis(cachedModel &model, const std::vector<int> &basis);
+
+            long getHits() const { return hits; }
+            long getMisses() const { return misses; }
+
+        private:
+
+            int capacity;
+
+            std::mutex mutex;
+
+            // Most recently used first
+            std::list< std::shared_ptr<cachedModel> > order;
+            std::unordered_map< std::uint64_t, std::list< std::shared_ptr<cachedModel> >::iterator > index;
+
+            long hits;
+            long misses;
+    };
+
+};
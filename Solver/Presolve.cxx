@@ -0,0 +1,574 @@
+/**
+ * @file Presolve.cxx
+ * @brief File implemented to implement the presolve, which shrinks a system before the table is built
+ * @version 0.1
+ *
+ */
+
+#include "Presolve.hxx"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+
+namespace Solver {
+
+    namespace {
+
+        const double INF = std::numeric_limits<double>::infinity();
+
+        // Close enough to be the same value, relative to its size
+        bool isClose(double first, double second) {
+            return std::fabs(first - second) <= Presolve::TOLERANCE*(1 + std::fabs(first));
+        }
+
+        // Same hash for values that would be close, so duplicates meet in the same bucket
+        void mix(std::size_t &hash, int index, double value) {
+            hash = hash*31 + std::hash<int>()(index);
+            hash = hash*31 + std::hash<long long>()(std::llround(value*1e6));
+        }
+
+    };
+
+    Presolve::Presolve(LinearSystems::System * original) : original(original), reduced(nullptr) {
+        numRes = original->getNumberOfRestrictions();
+        numVar = original->getNumberOfVariables();
+
+        LinearSystems::Restriction * restrictions = original->getRestrictions();
+        rows.assign(numRes, std::vector<double>(numVar, 0));
+        for (int i = 0; i < numRes; ++i) {
+            LinearSystems::restrictionItem * items = restrictions[i].getRestriction();
+            for (int j = 0; j < numVar; ++j) {
+                rows[i][j] = items[j].second.getValue();
+            }
+            LinearSystems::symbolEnum symbol = static_cast<LinearSystems::symbolEnum>(
+                                                   static_cast<int>(items[numVar].second.getValue()));
+            symbols.push_back(symbol);
+            if (symbol == LinearSystems::LOWER_EQUAL) {
+                types.push_back(LESS);
+            } else if (symbol == LinearSystems::HIGHER_EQUAL) {
+                types.push_back(GREATER);
+            } else if (symbol == LinearSystems::EQUAL) {
+                types.push_back(EQUALS);
+            } else {
+                types.push_back(KEPT);
+            }
+            b.push_back(items[numVar+1].second.getValue());
+        }
+
+        // Already negated for MIN, it always maximizes
+        LinearSystems::restrictionItem * objective = original->getObjective()->getRestriction();
+        for (int j = 0; j < numVar; ++j) {
+            costs.push_back(objective[j].second.getValue());
+        }
+
+        lower.assign(numVar, 0);
+        upper.assign(numVar, INF);
+        activeRow.assign(numRes, true);
+        activeColumn.assign(numVar, true);
+
+        singletonRows = emptyRows = redundantRows = duplicateRowCount = 0;
+        fixedColumnCount = dominatedColumnCount = duplicateColumnCount = forcedColumns = impliedBounds = 0;
+    }
+
+    status Presolve::run() {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            if (!emptyAndSingletonRows(changed) || !fixedColumns(changed) ||
+                !tightenBounds(changed) || !duplicateRows(changed)) {
+                return NON_VIABLE;
+            }
+            dominatedColumns(changed);
+            duplicateColumns(changed);
+        }
+
+        // x = l + x', so every variable left starts at 0
+        for (int j = 0; j < numVar; ++j) {
+            if (!activeColumn[j] || lower[j] == 0) {
+                continue;
+            }
+            for (int i = 0; i < numRes; ++i) {
+                b[i] -= rows[i][j]*lower[j];
+            }
+            upper[j] -= lower[j];
+            stack.push_back(step{step::SHIFT_COLUMN, j, lower[j]});
+            lower[j] = 0;
+        }
+
+        bool hasRows = std::find(activeRow.begin(), activeRow.end(), true) != activeRow.end();
+        bool hasColumns = std::find(activeColumn.begin(), activeColumn.end(), true) != activeColumn.end();
+        if (!hasRows) {
+            // Variables left are in no restriction and make it better without a bound
+            return hasColumns ? NO_FRONTIER : DONE;
+        }
+        buildReduced();
+        return WORK;
+    }
+
+    void Presolve::dropRow(int row) {
+        activeRow[row] = false;
+        stack.push_back(step{step::DROP_ROW, row, 0});
+    }
+
+    void Presolve::fixColumn(int column, double value) {
+        for (int i = 0; i < numRes; ++i) {
+            b[i] -= rows[i][column]*value;
+            rows[i][column] = 0;
+        }
+        lower[column] = upper[column] = value;
+        activeColumn[column] = false;
+        stack.push_back(step{step::FIX_COLUMN, column, value});
+    }
+
+    bool Presolve::setBounds(int column, double newLower, double newUpper) {
+        lower[column] = std::max(lower[column], newLower);
+        upper[column] = std::min(upper[column], newUpper);
+        if (lower[column] > upper[column] + TOLERANCE*(1 + std::fabs(lower[column]))) {
+            return false;
+        }
+        upper[column] = std::max(upper[column], lower[column]);
+        return true;
+    }
+
+    bool Presolve::emptyAndSingletonRows(bool &changed) {
+        for (int i = 0; i < numRes; ++i) {
+            if (!activeRow[i] || types[i] == KEPT) {
+                continue;
+            }
+            int count = 0;
+            int column = -1;
+            for (int j = 0; j < numVar && count < 2; ++j) {
+                if (activeColumn[j] && rows[i][j] != 0) {
+                    ++count;
+                    column = j;
+                }
+            }
+
+            if (count == 0) {
+                // 0 ? b
+                double tolerance = TOLERANCE*(1 + std::fabs(b[i]));
+                if ((types[i] != GREATER && b[i] < -tolerance) || (types[i] != LESS && b[i] > tolerance)) {
+                    return false;
+                }
+                dropRow(i);
+                ++emptyRows;
+                changed = true;
+            } else if (count == 1) {
+                // a x_j ? b is a bound of x_j, the direction flips when a < 0
+                double a = rows[i][column];
+                double value = b[i]/a;
+                bool isUpper = (types[i] == LESS) == (a > 0);
+                bool ok = types[i] == EQUALS ? setBounds(column, value, value) :
+                          isUpper ? setBounds(column, 0, value) : setBounds(column, value, INF);
+                if (!ok) {
+                    return false;
+                }
+                dropRow(i);
+                ++singletonRows;
+                changed = true;
+            }
+        }
+        return true;
+    }
+
+    bool Presolve::fixedColumns(bool &changed) {
+        for (int j = 0; j < numVar; ++j) {
+            if (activeColumn[j] && upper[j] - lower[j] <= TOLERANCE*(1 + std::fabs(lower[j]))) {
+                fixColumn(j, lower[j]);
+                ++fixedColumnCount;
+                changed = true;
+            }
+        }
+        return true;
+    }
+
+    void Presolve::activity(int row, double &lowest, int &lowestInfinite,
+                            double &highest, int &highestInfinite) const {
+        lowest = highest = 0;
+        lowestInfinite = highestInfinite = 0;
+        for (int j = 0; j < numVar; ++j) {
+            double a = rows[row][j];
+            if (!activeColumn[j] || a == 0) {
+                continue;
+            }
+            // Lower bounds are always finite (>= 0)
+            if (a > 0) {
+                lowest += a*lower[j];
+                if (upper[j] == INF) {
+                    ++highestInfinite;
+                } else {
+                    highest += a*upper[j];
+                }
+            } else {
+                highest += a*lower[j];
+                if (upper[j] == INF) {
+                    ++lowestInfinite;
+                } else {
+                    lowest += a*upper[j];
+                }
+            }
+        }
+    }
+
+    bool Presolve::tightenBounds(bool &changed) {
+        for (int i = 0; i < numRes; ++i) {
+            if (!activeRow[i] || types[i] == KEPT) {
+                continue;
+            }
+            double lowest, highest;
+            int lowestInfinite, highestInfinite;
+            activity(i, lowest, lowestInfinite, highest, highestInfinite);
+            double tolerance = TOLERANCE*(1 + std::fabs(b[i]));
+
+            // row <= b and/or row >= b
+            bool hasUpper = types[i] != GREATER;
+            bool hasLower = types[i] != LESS;
+            if ((hasUpper && lowestInfinite == 0 && lowest > b[i] + tolerance) ||
+                (hasLower && highestInfinite == 0 && highest < b[i] - tolerance)) {
+                return false;
+            }
+
+            // Whatever the variables are, it holds
+            if ((types[i] == LESS && highestInfinite == 0 && highest <= b[i] + tolerance) ||
+                (types[i] == GREATER && lowestInfinite == 0 && lowest >= b[i] - tolerance)) {
+                dropRow(i);
+                ++redundantRows;
+                changed = true;
+                continue;
+            }
+
+            /**
+             * Every other variable at its lowest (highest) gives how far x_j can go.
+             * Once something changes the activities are old, the next pass goes on
+             */
+            for (int j = 0; j < numVar; ++j) {
+                double a = rows[i][j];
+                if (!activeColumn[j] || a == 0) {
+                    continue;
+                }
+                bool isUnbounded = upper[j] == INF;
+                double impliedLower = 0;
+                double impliedUpper = INF;
+                if (hasUpper) {
+                    bool ownInfinite = a < 0 && isUnbounded;
+                    if (lowestInfinite - ownInfinite == 0) {
+                        double rest = lowest - (ownInfinite ? 0 : (a > 0 ? a*lower[j] : a*upper[j]));
+                        double bound = (b[i] - rest)/a;
+                        if (a > 0) {
+                            impliedUpper = std::min(impliedUpper, bound);
+                        } else {
+                            impliedLower = std::max(impliedLower, bound);
+                        }
+                    }
+                }
+                if (hasLower) {
+                    bool ownInfinite = a > 0 && isUnbounded;
+                    if (highestInfinite - ownInfinite == 0) {
+                        double rest = highest - (ownInfinite ? 0 : (a > 0 ? a*upper[j] : a*lower[j]));
+                        double bound = (b[i] - rest)/a;
+                        if (a > 0) {
+                            impliedLower = std::max(impliedLower, bound);
+                        } else {
+                            impliedUpper = std::min(impliedUpper, bound);
+                        }
+                    }
+                }
+
+                double columnTolerance = TOLERANCE*(1 + std::fabs(lower[j]));
+                if (impliedUpper <= lower[j] + columnTolerance) {
+                    // Forced to its lower bound
+                    fixColumn(j, lower[j]);
+                    ++forcedColumns;
+                    changed = true;
+                    break;
+                } else if (!isUnbounded && impliedLower >= upper[j] - columnTolerance) {
+                    fixColumn(j, upper[j]);
+                    ++forcedColumns;
+                    changed = true;
+                    break;
+                } else if (!isUnbounded && impliedUpper <= upper[j] + columnTolerance) {
+                    // The restriction already keeps it there, no need for a bound restriction
+                    upper[j] = INF;
+                    ++impliedBounds;
+                    changed = true;
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    int Presolve::effect(int row, int column) const {
+        double a = rows[row][column];
+        if (types[row] == LESS) {
+            return a > 0 ? -1 : 1;
+        } else if (types[row] == GREATER) {
+            return a > 0 ? 1 : -1;
+        }
+        return 0;
+    }
+
+    void Presolve::dominatedColumns(bool &changed) {
+        for (int j = 0; j < numVar; ++j) {
+            if (!activeColumn[j]) {
+                continue;
+            }
+            bool onlyRelaxes = true;
+            bool onlyTightens = true;
+            for (int i = 0; i < numRes && (onlyRelaxes || onlyTightens); ++i) {
+                if (!activeRow[i] || rows[i][j] == 0) {
+                    continue;
+                }
+                int direction = effect(i, j);
+                onlyRelaxes = onlyRelaxes && direction == 1;
+                onlyTightens = onlyTightens && direction == -1;
+            }
+
+            if (costs[j] <= 0 && onlyTightens) {
+                fixColumn(j, lower[j]);
+            } else if (costs[j] >= 0 && onlyRelaxes && upper[j] != INF) {
+                fixColumn(j, upper[j]);
+            } else {
+                continue;
+            }
+            ++dominatedColumnCount;
+            changed = true;
+        }
+    }
+
+    bool Presolve::duplicateRows(bool &changed) {
+        std::unordered_map<std::size_t, std::vector<int> > buckets;
+        for (int i = 0; i < numRes; ++i) {
+            if (!activeRow[i] || types[i] == KEPT) {
+                continue;
+            }
+            int first = -1;
+            std::size_t hash = 0;
+            for (int j = 0; j < numVar; ++j) {
+                if (!activeColumn[j] || rows[i][j] == 0) {
+                    continue;
+                }
+                if (first == -1) {
+                    first = j;
+                }
+                mix(hash, j, rows[i][j]/rows[i][first]);
+            }
+            if (first == -1) {
+                continue;
+            }
+
+            bool merged = false;
+            for (int k : buckets[hash]) {
+                // row i = factor * row k
+                double factor = rows[i][first]/rows[k][first];
+                bool isParallel = rows[k][first] != 0;
+                for (int j = 0; j < numVar && isParallel; ++j) {
+                    isParallel = !activeColumn[j] || isClose(rows[i][j], factor*rows[k][j]);
+                }
+                if (!isParallel) {
+                    continue;
+                }
+
+                // Both as an interval of row k
+                double lowK = types[k] == LESS ? -INF : b[k];
+                double highK = types[k] == GREATER ? INF : b[k];
+                rowType typeI = types[i];
+                if (factor < 0 && typeI != EQUALS) {
+                    typeI = typeI == LESS ? GREATER : LESS;
+                }
+                double valueI = b[i]/factor;
+                double low = std::max(lowK, typeI == LESS ? -INF : valueI);
+                double high = std::min(highK, typeI == GREATER ? INF : valueI);
+
+                if (low > high + TOLERANCE*(1 + std::fabs(low))) {
+                    return false;
+                } else if (low != -INF && high != INF && !isClose(low, high)) {
+                    // A range needs both of them
+                    continue;
+                }
+                if (low == -INF) {
+                    types[k] = LESS;
+                    b[k] = high;
+                } else if (high == INF) {
+                    types[k] = GREATER;
+                    b[k] = low;
+                } else {
+                    types[k] = EQUALS;
+                    b[k] = low;
+                }
+                dropRow(i);
+                ++duplicateRowCount;
+                changed = true;
+                merged = true;
+                break;
+            }
+            if (!merged) {
+                buckets[hash].push_back(i);
+            }
+        }
+        return true;
+    }
+
+    void Presolve::duplicateColumns(bool &changed) {
+        std::unordered_map<std::size_t, std::vector<int> > buckets;
+        for (int j = 0; j < numVar; ++j) {
+            // Only 0 <= x, moving one into the other must stay in the bounds
+            if (!activeColumn[j] || lower[j] != 0 || upper[j] != INF) {
+                continue;
+            }
+            int first = -1;
+            std::size_t hash = 0;
+            for (int i = 0; i < numRes; ++i) {
+                if (!activeRow[i] || rows[i][j] == 0) {
+                    continue;
+                }
+                if (first == -1) {
+                    first = i;
+                }
+                mix(hash, i, rows[i][j]/rows[first][j]);
+            }
+            if (first == -1) {
+                continue;
+            }
+
+            std::vector<int> &bucket = buckets[hash];
+            bool merged = false;
+            for (int &k : bucket) {
+                // column j = factor * column k, x_k + factor x_j does the same as both
+                double factor = rows[first][j]/rows[first][k];
+                bool isParallel = factor > 0;
+                for (int i = 0; i < numRes && isParallel; ++i) {
+                    isParallel = !activeRow[i] || isClose(rows[i][j], factor*rows[i][k]);
+                }
+                if (!isParallel) {
+                    continue;
+                }
+                // The one giving less for the same change stays at 0
+                if (costs[j] <= factor*costs[k]) {
+                    fixColumn(j, 0);
+                } else {
+                    fixColumn(k, 0);
+                    k = j;
+                }
+                ++duplicateColumnCount;
+                changed = true;
+                merged = true;
+                break;
+            }
+            if (!merged) {
+                bucket.push_back(j);
+            }
+        }
+    }
+
+    void Presolve::buildReduced() {
+        newColumn.assign(numVar, -1);
+        int variables = 0;
+        for (int j = 0; j < numVar; ++j) {
+            if (activeColumn[j]) {
+                newColumn[j] = variables++;
+            }
+        }
+
+        std::vector<LinearSystems::restrictionItem> objective;
+        for (int j = 0; j < numVar; ++j) {
+            if (activeColumn[j]) {
+                objective.push_back(LinearSystems::restrictionItem(LinearSystems::VALUE, Value::Number(costs[j])));
+            }
+        }
+        objective.push_back(LinearSystems::restrictionItem(LinearSystems::SYMBOL, Value::Number(LinearSystems::EQUAL)));
+        objective.push_back(LinearSystems::restrictionItem(LinearSystems::VALUE, Value::Number(0)));
+
+        std::vector<LinearSystems::Restriction> restrictionList;
+        std::vector<LinearSystems::restrictionItem> items;
+        auto addLine = [&](LinearSystems::symbolEnum symbol, double value) {
+            items.push_back(LinearSystems::restrictionItem(LinearSystems::SYMBOL, Value::Number(symbol)));
+            items.push_back(LinearSystems::restrictionItem(LinearSystems::VALUE, Value::Number(value)));
+            restrictionList.push_back(LinearSystems::Restriction(restrictionList.size()+1, items));
+        };
+
+        for (int i = 0; i < numRes; ++i) {
+            if (!activeRow[i]) {
+                continue;
+            }
+            items.clear();
+            for (int j = 0; j < numVar; ++j) {
+                if (activeColumn[j]) {
+                    items.push_back(LinearSystems::restrictionItem(LinearSystems::VALUE, Value::Number(rows[i][j])));
+                }
+            }
+            LinearSystems::symbolEnum symbol = types[i] == LESS ? LinearSystems::LOWER_EQUAL :
+                                               types[i] == GREATER ? LinearSystems::HIGHER_EQUAL :
+                                               types[i] == EQUALS ? LinearSystems::EQUAL : symbols[i];
+            addLine(symbol, b[i]);
+        }
+
+        // Upper bounds nothing else implies, as restrictions
+        for (int j = 0; j < numVar; ++j) {
+            if (!activeColumn[j] || upper[j] == INF) {
+                continue;
+            }
+            items.assign(variables, LinearSystems::restrictionItem(LinearSystems::VALUE, Value::Number(0)));
+            items[newColumn[j]].second = Value::Number(1);
+            addLine(LinearSystems::LOWER_EQUAL, upper[j]);
+        }
+
+        LinearSystems::Restriction objectiveRestriction(0, objective, original->getAction());
+        reduced = new LinearSystems::System(original->getAction(), objectiveRestriction, restrictionList);
+    }
+
+    std::vector<double> Presolve::postsolve(const std::vector<double> &values) const {
+        std::vector<double> result(numVar, 0);
+        for (int j = 0; j < numVar && !newColumn.empty(); ++j) {
+            if (newColumn[j] != -1 && newColumn[j] < static_cast<int>(values.size())) {
+                result[j] = values[newColumn[j]];
+            }
+        }
+        for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+            if (it->type == step::FIX_COLUMN) {
+                result[it->index] = it->value;
+            } else if (it->type == step::SHIFT_COLUMN) {
+                result[it->index] += it->value;
+            }
+        }
+        return result;
+    }
+
+    std::string Presolve::getResults(const std::vector<double> &values) const {
+        std::vector<double> result = postsolve(values);
+        double objectiveValue = 0;
+        for (int j = 0; j < numVar; ++j) {
+            objectiveValue += costs[j]*result[j];
+        }
+
+        std::string output = "Solution in the original variables\n";
+        if (original->getAction() == LinearSystems::MIN) {
+            output += "C: " + Value::Number(-objectiveValue).to_string();
+        } else {
+            output += "Z: " + Value::Number(objectiveValue).to_string();
+        }
+        output += "\n";
+        for (int j = 0; j < numVar; ++j) {
+            output += "x" + std::to_string(j+1) + " = " + Value::Number(result[j]).to_string() + "\n";
+        }
+        return output;
+    }
+
+    std::string Presolve::to_string() const {
+        int rowsLeft = std::count(activeRow.begin(), activeRow.end(), true);
+        int columnsLeft = std::count(activeColumn.begin(), activeColumn.end(), true);
+        return "Presolve: " + std::to_string(numRes - rowsLeft) + " of " + std::to_string(numRes) +
+               " restrictions and " + std::to_string(numVar - columnsLeft) + " of " + std::to_string(numVar) +
+               " variables removed\n" +
+               "  restrictions: " + std::to_string(emptyRows) + " empty, " + std::to_string(singletonRows) +
+               " singleton, " + std::to_string(redundantRows) + " redundant, " +
+               std::to_string(duplicateRowCount) + " duplicate\n" +
+               "  variables: " + std::to_string(fixedColumnCount) + " fixed, " + std::to_string(forcedColumns) +
+               " forced, " + std::to_string(dominatedColumnCount) + " dominated, " +
+               std::to_string(duplicateColumnCount) + " duplicate\n" +
+               "  bounds: " + std::to_string(impliedBounds) + " already implied by a restriction\n";
+    }
+
+};
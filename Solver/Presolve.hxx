@@ -0,0 +1,154 @@
+/**
+ * @file Presolve.hxx
+ * @brief File implemented to define the presolve, which shrinks a system before the table is built
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../Representation/LinearSystems/System.hxx"
+#include "Table.hxx"
+
+namespace Solver {
+
+    /**
+     * Takes out of a system what the table doesn't need to solve it, before any slack
+     * or artificial variable is added, and keeps what it did on a stack so the
+     * solution of the smaller system can be taken back to the original variables
+     *
+     * Repeated until nothing changes:
+     *  1 - Empty restrictions are dropped (or it's non viable)
+     *  2 - Singleton restrictions (a x_j ? b) become bounds of x_j
+     *  3 - Fixed variables (lower == upper) are replaced by their value
+     *  4 - Bound tightening: the lowest and highest values of each restriction imply bounds
+     *      on its variables, which fix forced variables and drop bounds already implied.
+     *      Restrictions that can never be broken are dropped
+     *  5 - Dominated variables: moving one only makes the objective worse (and never
+     *      fixes a restriction), so it stays at its bound
+     *  6 - Duplicate restrictions (one is a multiple of the other) keep the tighter one
+     *  7 - Duplicate variables (same column and cost, up to a factor) keep the better one
+     *
+     * The System only knows x >= 0: lower bounds are moved into b (x = l + x'), upper bounds
+     * that are left become x' <= u - l restrictions at the end
+     */
+    class Presolve {
+
+        public:
+
+            Presolve(LinearSystems::System * original);
+
+            /**
+             * Returns:
+             *  WORK        - the reduced system is ready (getReduced)
+             *  DONE        - nothing is left to solve, getResults has the solution
+             *  NON_VIABLE  - some restriction can't be met
+             *  NO_FRONTIER - no restriction is left and a variable improves forever
+             */
+            status run();
+
+            // The smaller system, nullptr unless run returned WORK
+            LinearSystems::System * getReduced() { return reduced; }
+
+            // Original variables (one each) from the variables of the reduced system
+            std::vector<double> postsolve(const std::vector<double> &values) const;
+
+            // Same text the table prints, in the original variables
+            std::string getResults(const std::vector<double> &values) const;
+
+            // What was removed
+            std::string to_string() const;
+
+            static constexpr double TOLERANCE = 1e-9;
+
+        private:
+
+            enum rowType {
+                LESS,       // <=
+                GREATER,    // >=
+                EQUALS,     // =
+                KEPT        // < and >, left as they are
+            };
+
+            // Each reduction, undone in the reverse order
+            struct step {
+                enum kind {
+                    DROP_ROW,       // Restriction dropped, nothing to undo on the variables
+                    FIX_COLUMN,     // x_column = value
+                    SHIFT_COLUMN    // x_column = value + x'_column
+                } type;
+                int index;
+                double value;
+            };
+
+            void dropRow(int row);
+
+            void fixColumn(int column, double value);
+
+            // Returns false if it's non viable
+            bool emptyAndSingletonRows(bool &changed);
+
+            bool fixedColumns(bool &changed);
+
+            bool tightenBounds(bool &changed);
+
+            void dominatedColumns(bool &changed);
+
+            bool duplicateRows(bool &changed);
+
+            void duplicateColumns(bool &changed);
+
+            // Sets a bound from a singleton (or forcing) restriction, false if lower > upper
+            bool setBounds(int column, double newLower, double newUpper);
+
+            /**
+             * Lowest and highest value of the restriction over the bounds, the finite part
+             * and how many variables make it infinite (so one of them can be taken out)
+             */
+            void activity(int row, double &lowest, int &lowestInfinite,
+                          double &highest, int &highestInfinite) const;
+
+            // What increasing x_j does to the row: 1 relaxes it, -1 tightens it, 0 both or neither
+            int effect(int row, int column) const;
+
+            void buildReduced();
+
+            LinearSystems::System * original;
+            LinearSystems::System * reduced;
+
+            int numRes;
+            int numVar;
+
+            // Dense copy of the restrictions, the System has them dense as well
+            std::vector< std::vector<double> > rows;
+            std::vector<rowType> types;
+            std::vector<LinearSystems::symbolEnum> symbols;
+            std::vector<double> b;
+            std::vector<double> costs;
+
+            std::vector<double> lower;
+            std::vector<double> upper;
+
+            std::vector<bool> activeRow;
+            std::vector<bool> activeColumn;
+
+            // Reduced variable of each original one (-1 if removed)
+            std::vector<int> newColumn;
+
+            std::vector<step> stack;
+
+            // Counts by reduction, for to_string
+            int singletonRows;
+            int emptyRows;
+            int redundantRows;
+            int duplicateRowCount;
+            int fixedColumnCount;
+            int dominatedColumnCount;
+            int duplicateColumnCount;
+            int forcedColumns;
+            int impliedBounds;
+    };
+
+};
@@ -0,0 +1,193 @@
+/**
+ * @file Pricing.cxx
+ * @brief File implemented to define the pricing rules, how the entering column is chosen
+ * @version 0.1
+ *
+ */
+
+#include "Pricing.hxx"
+#include <algorithm>
+#include <cmath>
+
+namespace Solver {
+
+    bool pricingFromName(const std::string &name, pricingRule &rule) {
+        if (name == "dantzig") {
+            rule = DANTZIG;
+        } else if (name == "devex") {
+            rule = DEVEX;
+        } else if (name == "steepest" || name == "steepest-edge") {
+            rule = STEEPEST_EDGE;
+        } else if (name == "partial") {
+            rule = PARTIAL;
+        } else if (name == "bland") {
+            rule = BLAND;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    std::string to_string(pricingRule rule) {
+        switch (rule) {
+            case DEVEX:
+                return "devex";
+            case STEEPEST_EDGE:
+                return "steepest";
+            case PARTIAL:
+                return "partial";
+            case BLAND:
+                return "bland";
+            default:
+                return "dantzig";
+        }
+    }
+
+    std::shared_ptr<Pricing> Pricing::create(pricingRule rule) {
+        switch (rule) {
+            case DEVEX:
+                return std::make_shared<DevexPricing>();
+            case STEEPEST_EDGE:
+                return std::make_shared<SteepestEdgePricing>();
+            case PARTIAL:
+                return std::make_shared<PartialPricing>();
+            case BLAND:
+                return std::make_shared<BlandPricing>();
+            default:
+                return std::make_shared<DantzigPricing>();
+        }
+    }
+
+    int DantzigPricing::choose(const PricingSource &source, const std::vector<int> &nonBasic) {
+        int chosen = -1;
+        Value::Number best;
+        for (int j : nonBasic) {
+            Value::Number cost = source.reducedCost(j);
+            if (!source.isImproving(cost)) {
+                continue;
+            }
+            // Highest one, the lowest column among the same values
+            if (chosen == -1 || source.isHigherCost(cost, best) ||
+                (!source.isHigherCost(best, cost) && j < chosen)) {
+                best = cost;
+                chosen = j;
+            }
+        }
+        return chosen;
+    }
+
+    int BlandPricing::choose(const PricingSource &source, const std::vector<int> &nonBasic) {
+        int chosen = -1;
+        for (int j : nonBasic) {
+            if ((chosen == -1 || j < chosen) && source.isImproving(source.reducedCost(j))) {
+                chosen = j;
+            }
+        }
+        return chosen;
+    }
+
+    int WeightedPricing::choose(const PricingSource &source, const std::vector<int> &nonBasic) {
+        int chosen = -1;
+        double bestM = 0;
+        double best = 0;
+        for (int j : nonBasic) {
+            Value::Number cost = source.reducedCost(j);
+            if (!source.isImproving(cost)) {
+                continue;
+            }
+            // (Cj - Zj)^2 / w with the sign kept, M part first
+            double Mscore = cost.getMvalue()*std::fabs(cost.getMvalue())/weights[j];
+            double score = cost.getValue()*std::fabs(cost.getValue())/weights[j];
+            if (chosen == -1 || Mscore > bestM || (Mscore == bestM && score > best) ||
+                (Mscore == bestM && score == best && j < chosen)) {
+                bestM = Mscore;
+                best = score;
+                chosen = j;
+            }
+        }
+        return chosen;
+    }
+
+    void DevexPricing::start(const PricingSource & /* source */, int columns) {
+        weights.assign(columns, 1);
+    }
+
+    void DevexPricing::update(const PricingSource &source, const std::vector<int> &nonBasic,
+                              int entering, int leaving, int line) {
+        source.pivotRow(line, row);
+        double pivot = row[entering];
+        double enteringWeight = weights[entering];
+
+        for (int j : nonBasic) {
+            if (j == entering || row[j] == 0) {
+                continue;
+            }
+            double ratio = row[j]/pivot;
+            weights[j] = std::max(weights[j], ratio*ratio*enteringWeight);
+        }
+        weights[leaving] = std::max(enteringWeight/(pivot*pivot), 1.0);
+
+        // Too far from the reference framework, start a new one
+        if (weights[leaving] > RESET_WEIGHT) {
+            std::fill(weights.begin(), weights.end(), 1);
+        }
+    }
+
+    void SteepestEdgePricing::start(const PricingSource &source, int columns) {
+        weights.resize(columns);
+        for (int j = 0; j < columns; ++j) {
+            weights[j] = 1 + source.columnNorm(j);
+        }
+    }
+
+    void SteepestEdgePricing::update(const PricingSource &source, const std::vector<int> &nonBasic,
+                                     int entering, int leaving, int line) {
+        source.pivotRow(line, row);
+        source.columnDots(entering, dots);
+        double pivot = row[entering];
+        double enteringWeight = weights[entering];
+
+        for (int j : nonBasic) {
+            if (j == entering || row[j] == 0) {
+                continue;
+            }
+            double ratio = row[j]/pivot;
+            // Rounding can't take it below its smallest possible value
+            weights[j] = std::max(weights[j] - 2*ratio*dots[j] + ratio*ratio*enteringWeight, 1 + ratio*ratio);
+        }
+        weights[leaving] = std::max(enteringWeight/(pivot*pivot), 1.0);
+    }
+
+    int PartialPricing::choose(const PricingSource &source, const std::vector<int> &nonBasic) {
+        int size = nonBasic.size();
+        if (size == 0) {
+            return -1;
+        }
+        int blockSize = (size + BLOCKS - 1)/BLOCKS;
+        int blocks = (size + blockSize - 1)/blockSize;
+
+        for (int b = 0; b < blocks; ++b) {
+            int block = (nextBlock + b) % blocks;
+            int chosen = -1;
+            Value::Number best;
+            for (int k = block*blockSize; k < std::min(size, (block+1)*blockSize); ++k) {
+                int j = nonBasic[k];
+                Value::Number cost = source.reducedCost(j);
+                if (!source.isImproving(cost)) {
+                    continue;
+                }
+                if (chosen == -1 || source.isHigherCost(cost, best) ||
+                    (!source.isHigherCost(best, cost) && j < chosen)) {
+                    best = cost;
+                    chosen = j;
+                }
+            }
+            if (chosen != -1) {
+                nextBlock = (block + 1) % blocks;
+                return chosen;
+            }
+        }
+        return -1;
+    }
+
+};
@@ -0,0 +1,180 @@
+/**
+ * @file Pricing.hxx
+ * @brief File implemented to define the pricing rules, how the entering column is chosen
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include "../Representation/Values/Number.hxx"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Solver {
+
+    enum pricingRule {
+        DANTZIG,        // Highest (Cj - Zj)
+        DEVEX,          // Highest (Cj - Zj)^2 / w, w approximates the steepest edge weights
+        STEEPEST_EDGE,  // Highest (Cj - Zj)^2 / (1 + |B^-1 a_j|^2), weights updated every pivot
+        PARTIAL,        // Highest (Cj - Zj) of the first block of columns that has one
+        BLAND           // Lowest column that makes it better, never cycles
+    };
+
+    // "dantzig", "devex", "steepest", "partial" or "bland", false if the name is none of them
+    bool pricingFromName(const std::string &name, pricingRule &rule);
+
+    std::string to_string(pricingRule rule);
+
+    /**
+     * What a pricing rule needs from the engine (Table or Revised),
+     * t_j being the column j of B^-1 A (the column j of the table)
+     */
+    class PricingSource {
+
+        public:
+
+            virtual ~PricingSource() {}
+
+            // (Cj - Zj) of a non base column
+            virtual Value::Number reducedCost(int column) const = 0;
+
+            // Whether (Cj - Zj) makes the objective better, with the engine's tolerance
+            virtual bool isImproving(const Value::Number &cost) const = 0;
+
+            // Same order the engine uses to compare (Cj - Zj)
+            virtual bool isHigherCost(const Value::Number &first, const Value::Number &second) const = 0;
+
+            // |t_j|^2
+            virtual double columnNorm(int column) const = 0;
+
+            // Line of B^-1 A, one value per column
+            virtual void pivotRow(int line, std::vector<double> &row) const = 0;
+
+            // t_j . t_column, one value per column
+            virtual void columnDots(int column, std::vector<double> &dots) const = 0;
+    };
+
+    /**
+     * Chooses the entering column each iteration, keeping whatever it needs between them
+     *
+     * The engine calls start once, choose every iteration and update once the
+     * leaving line is known, before the pivot changes the table/basis
+     */
+    class Pricing {
+
+        public:
+
+            virtual ~Pricing() {}
+
+            virtual pricingRule getRule() const = 0;
+
+            virtual void start(const PricingSource & /* source */, int /* columns */) {}
+
+            // Entering column among the non base ones, -1 if none makes it better
+            virtual int choose(const PricingSource &source, const std::vector<int> &nonBasic) = 0;
+
+            virtual void update(const PricingSource & /* source */, const std::vector<int> & /* nonBasic */,
+                                int /* entering */, int /* leaving */, int /* line */) {}
+
+            static std::shared_ptr<Pricing> create(pricingRule rule);
+    };
+
+    class DantzigPricing : public Pricing {
+
+        public:
+
+            pricingRule getRule() const { return DANTZIG; }
+
+            int choose(const PricingSource &source, const std::vector<int> &nonBasic);
+    };
+
+    /**
+     * Weighted rules (Devex and steepest edge) share the choice, (Cj - Zj)^2 / weight
+     * with the M part first, they only keep their weights differently
+     */
+    class WeightedPricing : public Pricing {
+
+        public:
+
+            int choose(const PricingSource &source, const std::vector<int> &nonBasic);
+
+        protected:
+
+            std::vector<double> weights;
+
+            // Reused on every update
+            std::vector<double> row;
+            std::vector<double> dots;
+    };
+
+    /**
+     * Reference framework of Forrest and Goldfarb: every weight starts at 1 and only grows,
+     * w_j = max(w_j, (a_rj/a_rq)^2 w_q), restarting when they get too large
+     */
+    class DevexPricing : public WeightedPricing {
+
+        public:
+
+            pricingRule getRule() const { return DEVEX; }
+
+            void start(const PricingSource &source, int columns);
+
+            void update(const PricingSource &source, const std::vector<int> &nonBasic,
+                        int entering, int leaving, int line);
+
+            static constexpr double RESET_WEIGHT = 1e6;
+    };
+
+    /**
+     * Exact weights 1 + |t_j|^2, calculated once and updated on every pivot (Goldfarb and Reid):
+     * w_j = w_j - 2 (a_rj/a_rq) t_j.t_q + (a_rj/a_rq)^2 w_q
+     */
+    class SteepestEdgePricing : public WeightedPricing {
+
+        public:
+
+            pricingRule getRule() const { return STEEPEST_EDGE; }
+
+            void start(const PricingSource &source, int columns);
+
+            void update(const PricingSource &source, const std::vector<int> &nonBasic,
+                        int entering, int leaving, int line);
+    };
+
+    /**
+     * Bland's rule, the lowest improving column (with the lowest leaving column on the ratio test ties)
+     * Slow, but it can't cycle, the engines move to it when they detect cycling
+     */
+    class BlandPricing : public Pricing {
+
+        public:
+
+            pricingRule getRule() const { return BLAND; }
+
+            int choose(const PricingSource &source, const std::vector<int> &nonBasic);
+    };
+
+    /**
+     * The non base columns are split in BLOCKS blocks, each iteration starts on the block
+     * after the last one used and takes the highest (Cj - Zj) of the first block having one
+     */
+    class PartialPricing : public Pricing {
+
+        public:
+
+            PartialPricing() : nextBlock(0) {}
+
+            pricingRule getRule() const { return PARTIAL; }
+
+            int choose(const PricingSource &source, const std::vector<int> &nonBasic);
+
+            static const int BLOCKS = 8;
+
+        private:
+
+            int nextBlock;
+    };
+
+};
@@ -0,0 +1,157 @@
+/**
+ * @file RatioTest.cxx
+ * @brief File implemented to implement the ratio test, how the leaving line is chosen
+ * @version 0.1
+ *
+ */
+
+#include "RatioTest.hxx"
+#include <algorithm>
+#include <cmath>
+
+namespace Solver {
+
+    RatioTest::RatioTest(double feasibilityTolerance, double pivotTolerance) :
+        feasibilityTolerance(feasibilityTolerance), pivotTolerance(pivotTolerance) {}
+
+    ratioStep RatioTest::choose(const std::vector<double> &column, const std::vector<double> &values,
+                                const std::vector<double> &upper, double enteringUpper) const {
+        int rows = column.size();
+        bool hasUpper = !upper.empty();
+
+        // 1 - Longest step with every value relaxed by the tolerance
+        double maxStep = INFINITE;
+        for (int i = 0; i < rows; ++i) {
+            if (column[i] > pivotTolerance) {
+                maxStep = std::min(maxStep, (values[i] + feasibilityTolerance)/column[i]);
+            } else if (column[i] < -pivotTolerance && hasUpper && upper[i] != INFINITE) {
+                maxStep = std::min(maxStep, (upper[i] - values[i] + feasibilityTolerance)/(-column[i]));
+            }
+        }
+
+        ratioStep step{-1, 0, false, false, false};
+        if (enteringUpper != INFINITE && enteringUpper <= maxStep) {
+            // Gets to its own bound before anything leaves
+            step.theta = enteringUpper;
+            step.boundFlip = true;
+            step.degenerate = enteringUpper <= feasibilityTolerance;
+            return step;
+        }
+        if (maxStep == INFINITE) {
+            // Nothing blocks it, unbounded
+            return step;
+        }
+
+        // 2 - Largest pivot among the lines blocking within that step
+        double largest = 0;
+        for (int i = 0; i < rows; ++i) {
+            double ratio;
+            bool toUpper = false;
+            if (column[i] > pivotTolerance) {
+                ratio = values[i]/column[i];
+            } else if (column[i] < -pivotTolerance && hasUpper && upper[i] != INFINITE) {
+                ratio = (upper[i] - values[i])/(-column[i]);
+                toUpper = true;
+            } else {
+                continue;
+            }
+            if (ratio <= maxStep && std::fabs(column[i]) > largest) {
+                largest = std::fabs(column[i]);
+                step.line = i;
+                step.theta = ratio;
+                step.toUpper = toUpper;
+            }
+        }
+
+        // Slightly infeasible values give negative ratios, the step never goes back
+        step.theta = std::max(step.theta, 0.0);
+        step.degenerate = step.theta <= feasibilityTolerance;
+        return step;
+    }
+
+    ratioStep RatioTest::chooseLowestIndex(const std::vector<double> &column, const std::vector<double> &values,
+                                           const std::vector<int> &baseColumns,
+                                           const std::vector<double> &upper, double enteringUpper) const {
+        ratioStep step{-1, 0, false, false, false};
+        bool hasUpper = !upper.empty();
+        for (int i = 0; i < static_cast<int>(column.size()); ++i) {
+            double ratio;
+            bool toUpper = false;
+            if (column[i] > pivotTolerance) {
+                ratio = values[i]/column[i];
+            } else if (column[i] < -pivotTolerance && hasUpper && upper[i] != INFINITE) {
+                ratio = (upper[i] - values[i])/(-column[i]);
+                toUpper = true;
+            } else {
+                continue;
+            }
+            if (step.line == -1 || ratio < step.theta - feasibilityTolerance ||
+                (ratio <= step.theta + feasibilityTolerance && baseColumns[i] < baseColumns[step.line])) {
+                step.line = i;
+                step.theta = ratio;
+                step.toUpper = toUpper;
+            }
+        }
+        if (enteringUpper != INFINITE && (step.line == -1 || enteringUpper <= step.theta)) {
+            step = ratioStep{-1, enteringUpper, true, false, enteringUpper <= feasibilityTolerance};
+            return step;
+        }
+        step.theta = std::max(step.theta, 0.0);
+        step.degenerate = step.line != -1 && step.theta <= feasibilityTolerance;
+        return step;
+    }
+
+    dualStep RatioTest::chooseDual(const std::vector<double> &row, const std::vector<double> &costs,
+                                   const std::vector<int> &candidates, double infeasibility,
+                                   const std::vector<double> &upper) const {
+        // (ratio, column) of every column that can enter
+        std::vector< std::pair<double, int> > eligible;
+        for (int j : candidates) {
+            if (row[j] < -pivotTolerance) {
+                eligible.push_back(std::make_pair(costs[j]/row[j], j));
+            }
+        }
+
+        dualStep step{-1, 0, std::vector<int>()};
+        std::size_t first = 0;
+        if (!upper.empty()) {
+            // Long step: pass over the boxed columns while the line stays infeasible. The one whose
+            // flip would just get it to 0 (within the tolerance) enters instead, so there's a pivot
+            std::sort(eligible.begin(), eligible.end());
+            double slope = infeasibility;
+            while (first < eligible.size()) {
+                int j = eligible[first].second;
+                if (upper[j] == INFINITE || slope - std::fabs(row[j])*upper[j] <= feasibilityTolerance) {
+                    break;
+                }
+                slope -= std::fabs(row[j])*upper[j];
+                step.flips.push_back(j);
+                ++first;
+            }
+        }
+
+        // 1 - Longest step with every (Cj - Zj) relaxed by the tolerance
+        double maxStep = INFINITE;
+        for (std::size_t k = first; k < eligible.size(); ++k) {
+            int j = eligible[k].second;
+            maxStep = std::min(maxStep, (costs[j] - feasibilityTolerance)/row[j]);
+        }
+
+        // 2 - Largest pivot within that step
+        double largest = 0;
+        for (std::size_t k = first; k < eligible.size(); ++k) {
+            int j = eligible[k].second;
+            if (eligible[k].first <= maxStep &&
+                (std::fabs(row[j]) > largest || (std::fabs(row[j]) == largest && j < step.column))) {
+                largest = std::fabs(row[j]);
+                step.column = j;
+                step.theta = std::max(eligible[k].first, 0.0);
+            }
+        }
+        if (step.column == -1) {
+            step.flips.clear();
+        }
+        return step;
+    }
+
+};
@@ -0,0 +1,101 @@
+/**
+ * @file RatioTest.hxx
+ * @brief File implemented to define the ratio test, how the leaving line is chosen
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+namespace Solver {
+
+    // What the ratio test found for the entering column
+    struct ratioStep {
+        int line;           // Leaving line, -1 if nothing leaves (unbounded or bound flip)
+        double theta;       // How much the entering variable grows
+        bool boundFlip;     // The entering variable reaches its own upper bound first, no pivot
+        bool toUpper;       // The leaving variable stops at its upper bound instead of 0
+        bool degenerate;    // theta is 0 (within the feasibility tolerance)
+    };
+
+    // What the dual ratio test found for the leaving line
+    struct dualStep {
+        int column;                 // Entering column, -1 if none can (primal infeasible)
+        double theta;               // Step on the reduced costs
+        std::vector<int> flips;     // Boxed columns passed over, they go to their other bound
+    };
+
+    /**
+     * Harris two-pass ratio test:
+     *  1 - Every line that blocks the entering variable gives its ratio with the values
+     *      relaxed by the feasibility tolerance, the lowest one is the longest safe step
+     *  2 - Among the lines whose exact ratio is within that step, the largest |pivot| leaves
+     *      (the lowest line among the same ones)
+     *
+     * Only entries above the pivot tolerance block: positive ones as their variable goes
+     * down to 0, negative ones as it goes up to its upper bound (when it has one).
+     * When the entering variable has an upper bound below the step it only flips to it,
+     * the long step that needs no pivot at all
+     *
+     * A degenerate step (theta 0) is a normal step, it's up to the engine to go on
+     */
+    class RatioTest {
+
+        public:
+
+            RatioTest(double feasibilityTolerance = FEASIBILITY_TOLERANCE,
+                      double pivotTolerance = PIVOT_TOLERANCE);
+
+            /**
+             * column: entering column of the table (B^-1 a_q)
+             * values: value of the base variable of each line (b)
+             * upper: upper bound of the base variable of each line, empty if none has one
+             * enteringUpper: upper bound of the entering variable
+             */
+            ratioStep choose(const std::vector<double> &column, const std::vector<double> &values,
+                             const std::vector<double> &upper = std::vector<double>(),
+                             double enteringUpper = INFINITE) const;
+
+            /**
+             * Textbook minimum ratio for Bland's rule, ties go to the line whose base
+             * variable has the lowest column (baseColumns[i] for line i). Same bounds as choose()
+             */
+            ratioStep chooseLowestIndex(const std::vector<double> &column, const std::vector<double> &values,
+                                        const std::vector<int> &baseColumns,
+                                        const std::vector<double> &upper = std::vector<double>(),
+                                        double enteringUpper = INFINITE) const;
+
+            /**
+             * Dual ratio test over the line leaving the base (its value is negative):
+             *  row: the line of the table, one value per column
+             *  costs: (Cj - Zj) of each column, all <= 0 on a dual feasible base
+             *  candidates: columns that may enter
+             *  infeasibility: how far below 0 the base value of the line is
+             *  upper: upper bound of each column, empty if none has one
+             *
+             * Only entries below minus the pivot tolerance can enter, with the ratio (Cj - Zj)/a_rj.
+             * Bound flipping: going through the ratios in order, a boxed column is passed over
+             * (flipped to its other bound) as long as the line stays infeasible after it, so one pivot
+             * can do the work of several. Among the rest, the same two passes of choose() pick the column
+             */
+            dualStep chooseDual(const std::vector<double> &row, const std::vector<double> &costs,
+                                const std::vector<int> &candidates, double infeasibility,
+                                const std::vector<double> &upper = std::vector<double>()) const;
+
+            double getFeasibilityTolerance() const { return feasibilityTolerance; }
+            double getPivotTolerance() const { return pivotTolerance; }
+
+            static constexpr double FEASIBILITY_TOLERANCE = 1e-9;
+            static constexpr double PIVOT_TOLERANCE = 1e-9;
+            static constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+        private:
+
+            double feasibilityTolerance;
+            double pivotTolerance;
+    };
+
+};
@@ -0,0 +1,350 @@
+/**
+ * @file Revised.cxx
+ * @brief File implemented to implement the revised simplex engine
+ * @version 0.1
+ *
+ */
+
+#include "Revised.hxx"
+#include <cmath>
+
+namespace Solver {
+
+    Revised::Revised(LinearSystems::SparseSystem * toSolveModel) :
+        model(toSolveModel), iterations(0), recoveryIterations(0), enteringColumn(-1), leavingColumn(-1), lastTheta(0), singular(false) {
+
+        numRes = model->getNumberOfRestrictions();
+        numVar = model->getNumberOfVariables();
+
+        basis = model->getInitialBasis();
+        position.assign(numVar, -1);
+        for (int i = 0; i < numRes; ++i) {
+            position[basis[i]] = i;
+        }
+        nonBasicPosition.assign(numVar, -1);
+        for (int j = 0; j < numVar; ++j) {
+            if (position[j] == -1) {
+                nonBasicPosition[j] = nonBasic.size();
+                nonBasic.push_back(j);
+            }
+        }
+
+        // Slack and artificial columns only, this one is never singular
+        refactor();
+
+        setPricing(DANTZIG);
+        antiCycling.start(basis);
+    }
+
+    void Revised::setPricing(pricingRule rule) {
+        pricing = Pricing::create(rule);
+        pricing->start(*this, numVar);
+    }
+
+    bool Revised::refactor() {
+        const LinearSystems::SparseMatrix &matrix = model->getMatrix();
+        std::vector< std::vector<double> > baseColumns(numRes);
+        for (int i = 0; i < numRes; ++i) {
+            matrix.scatterColumn(basis[i], baseColumns[i]);
+        }
+        if (!factorization.factorize(baseColumns)) {
+            singular = true;
+            return false;
+        }
+        // Recalculate the base values from scratch, dropping the error of the updates
+        baseValues = model->getB();
+        for (std::size_t i = 0; i < perturbation.size(); ++i) {
+            baseValues[i] += perturbation[i];
+        }
+        factorization.solve(baseValues);
+        return true;
+    }
+
+    void Revised::calculatePrices() {
+        prices.assign(numRes, 0);
+        Mprices.assign(numRes, 0);
+        const std::vector<Value::Number> &costs = model->getCosts();
+        for (int i = 0; i < numRes; ++i) {
+            prices[i] = costs[basis[i]].getValue();
+            Mprices[i] = costs[basis[i]].getMvalue();
+        }
+        factorization.solveTransposed(prices);
+        factorization.solveTransposed(Mprices);
+    }
+
+    Value::Number Revised::reducedCost(int column) const {
+        // Only the non zeros of the column are visited
+        const LinearSystems::SparseMatrix &matrix = model->getMatrix();
+        const Value::Number &cost = model->getCosts()[column];
+        double value = 0;
+        double Mvalue = 0;
+        for (int k = matrix.columnBegin(column); k < matrix.columnEnd(column); ++k) {
+            int line = matrix.getLineIndex(k);
+            value += prices[line]*matrix.getColumnValue(k);
+            Mvalue += Mprices[line]*matrix.getColumnValue(k);
+        }
+        return Value::Number(cost.getValue() - value, cost.getMvalue() - Mvalue);
+    }
+
+    double Revised::columnNorm(int column) const {
+        std::vector<double> values;
+        model->getMatrix().scatterColumn(column, values);
+        factorization.solve(values);
+        double norm = 0;
+        for (double value : values) {
+            norm += value*value;
+        }
+        return norm;
+    }
+
+    void Revised::pivotRow(int line, std::vector<double> &row) const {
+        // e_r B^-1, then its product with every column
+        std::vector<double> rho(numRes, 0);
+        rho[line] = 1;
+        factorization.solveTransposed(rho);
+        const LinearSystems::SparseMatrix &matrix = model->getMatrix();
+        row.resize(numVar);
+        for (int j = 0; j < numVar; ++j) {
+            row[j] = matrix.dotColumn(j, rho);
+        }
+    }
+
+    void Revised::columnDots(int column, std::vector<double> &dots) const {
+        // (B^-1 a_j).(B^-1 a_q) = a_j.(B^-T B^-1 a_q)
+        std::vector<double> tau;
+        const LinearSystems::SparseMatrix &matrix = model->getMatrix();
+        matrix.scatterColumn(column, tau);
+        factorization.solve(tau);
+        factorization.solveTransposed(tau);
+        dots.resize(numVar);
+        for (int j = 0; j < numVar; ++j) {
+            dots[j] = matrix.dotColumn(j, tau);
+        }
+    }
+
+    bool Revised::isPositive(const Value::Number &input) {
+        if (std::fabs(input.getMvalue()) > OPTIMALITY_TOLERANCE) {
+            return input.getMvalue() > 0;
+        }
+        return input.getValue() > OPTIMALITY_TOLERANCE;
+    }
+
+    bool Revised::isHigher(const Value::Number &first, const Value::Number &second) {
+        // M dominates, the real part only breaks ties
+        double difference = first.getMvalue() - second.getMvalue();
+        if (std::fabs(difference) > OPTIMALITY_TOLERANCE) {
+            return difference > 0;
+        }
+        return first.getValue() > second.getValue();
+    }
+
+    status Revised::iterate() {
+        if (factorization.needsRefactor() && !refactor()) {
+            return NON_VIABLE;
+        }
+
+        // 1 - Pricing, the rule chooses among the improving (Cj - Zj)
+        calculatePrices();
+        enteringColumn = pricing->choose(*this, nonBasic);
+
+        if (enteringColumn == -1 && !perturbation.empty()) {
+            // Back to the real b, the base values that left their bounds are fixed by the dual simplex
+            removePerturbation();
+            if (!restoreFeasibility()) {
+                leavingColumn = -1;
+                return NON_VIABLE;
+            }
+            calculatePrices();
+            enteringColumn = pricing->choose(*this, nonBasic);
+        }
+
+        if (enteringColumn == -1) {
+            leavingColumn = -1;
+            for (int i = 0; i < numRes; ++i) {
+                if (model->isArtificial(basis[i]) && baseValues[i] > PIVOT_TOLERANCE) {
+                    return NON_VIABLE;
+                }
+            }
+            return DONE;
+        }
+
+        // 2 - Entering column, B^-1 a_q
+        std::vector<double> entering;
+        model->getMatrix().scatterColumn(enteringColumn, entering);
+        factorization.solve(entering);
+
+        // 3 - Ratio test (Harris), nothing has an upper bound here
+        ratioStep step = antiCycling.isActive() ? ratioTest.chooseLowestIndex(entering, baseValues, basis) :
+                                                  ratioTest.choose(entering, baseValues);
+        if (step.line == -1) {
+            leavingColumn = -1;
+            return NO_FRONTIER;
+        }
+        int pivotLine = step.line;
+        double theta = step.theta;
+
+        cycleEvent event = antiCycling.record(enteringColumn, basis[pivotLine], step.degenerate);
+        if (event == REPEATED_BASIS && antiCycling.isActive()) {
+            leavingColumn = -1;
+            return CYCLIC;
+        }
+
+        // 4 - Update weights (before the basis changes), values, basis and factorization
+        pivot(pivotLine, theta, entering);
+        ++iterations;
+
+        if (event != NO_CYCLE && !antiCycling.isActive()) {
+            perturb();
+        }
+        return WORK;
+    }
+
+    void Revised::pivot(int line, double theta, const std::vector<double> &entering) {
+        pricing->update(*this, nonBasic, enteringColumn, basis[line], line);
+
+        for (int i = 0; i < numRes; ++i) {
+            baseValues[i] -= theta*entering[i];
+        }
+        baseValues[line] = theta;
+
+        leavingColumn = basis[line];
+        position[leavingColumn] = -1;
+        nonBasic[nonBasicPosition[enteringColumn]] = leavingColumn;
+        nonBasicPosition[leavingColumn] = nonBasicPosition[enteringColumn];
+        nonBasicPosition[enteringColumn] = -1;
+        basis[line] = enteringColumn;
+        position[enteringColumn] = line;
+        factorization.update(entering, line);
+
+        lastTheta = theta;
+    }
+
+    bool Revised::restoreFeasibility() {
+        std::vector<double> row;
+        std::vector<double> entering;
+        while (true) {
+            if (factorization.needsRefactor() && !refactor()) {
+                return false;
+            }
+
+            // The most negative base value leaves
+            int line = -1;
+            for (int i = 0; i < numRes; ++i) {
+                if (baseValues[i] < -ratioTest.getFeasibilityTolerance() &&
+                    (line == -1 || baseValues[i] < baseValues[line])) {
+                    line = i;
+                }
+            }
+            if (line == -1) {
+                // Its bases went by without the anti cycling seeing them
+                antiCycling.start(basis);
+                return true;
+            }
+
+            // Dual ratio test over its line, the lowest (Cj - Zj)/a_rj among the a_rj < 0 keeps
+            // every (Cj - Zj) <= 0. Artificial columns never come back
+            calculatePrices();
+            pivotRow(line, row);
+            int column = -1;
+            Value::Number best(0);
+            for (int j : nonBasic) {
+                if (model->isArtificial(j) || row[j] > -PIVOT_TOLERANCE) {
+                    continue;
+                }
+                Value::Number ratio = reducedCost(j)*(1/row[j]);
+                if (column == -1 || isHigher(best, ratio)) {
+                    best = ratio;
+                    column = j;
+                }
+            }
+            if (column == -1) {
+                // Nothing can take it back to 0, the system has no solution
+                return false;
+            }
+
+            enteringColumn = column;
+            model->getMatrix().scatterColumn(column, entering);
+            factorization.solve(entering);
+            pivot(line, baseValues[line]/entering[line], entering);
+            ++recoveryIterations;
+        }
+    }
+
+    void Revised::perturb() {
+        // x_B + e, so b + B e
+        std::vector<double> added = antiCycling.perturbation(baseValues);
+        const LinearSystems::SparseMatrix &matrix = model->getMatrix();
+        perturbation.assign(numRes, 0);
+        for (int i = 0; i < numRes; ++i) {
+            baseValues[i] += added[i];
+            for (int k = matrix.columnBegin(basis[i]); k < matrix.columnEnd(basis[i]); ++k) {
+                perturbation[matrix.getLineIndex(k)] += matrix.getColumnValue(k)*added[i];
+            }
+        }
+
+        antiCycling.setActive(true);
+        antiCycling.start(basis);
+        pricing = Pricing::create(BLAND);
+        pricing->start(*this, numVar);
+    }
+
+    void Revised::removePerturbation() {
+        perturbation.clear();
+        baseValues = model->getB();
+        factorization.solve(baseValues);
+        for (double &value : baseValues) {
+            if (value < 0 && value > -AntiCycling::REMOVAL_TOLERANCE) {
+                value = 0;
+            }
+        }
+    }
+
+    std::string Revised::to_string() {
+        std::string output = "Iteration " + std::to_string(iterations) + ": ";
+        if (enteringColumn == -1 || leavingColumn == -1) {
+            return output + "no change";
+        }
+        const std::vector<Value::Number> &costs = model->getCosts();
+        Value::Number objectiveValue(0);
+        for (int i = 0; i < numRes; ++i) {
+            objectiveValue += costs[basis[i]]*baseValues[i];
+        }
+        output += "x" + std::to_string(enteringColumn+1) + " in, x" + std::to_string(leavingColumn+1) +
+                  " out, theta " + Value::Number::roundValue(lastTheta) +
+                  ", objective " + objectiveValue.to_string();
+        return output;
+    }
+
+    std::string Revised::getResults() {
+        std::string output = "Optimal solution found\n";
+
+        const std::vector<Value::Number> &costs = model->getCosts();
+        double objectiveValue = 0;
+        for (int i = 0; i < numRes; ++i) {
+            objectiveValue += costs[basis[i]].getValue()*baseValues[i];
+        }
+        if (model->getAction() == LinearSystems::MIN) {
+            output += "C: " + Value::Number(-objectiveValue).to_string();
+        } else {
+            output += "Z: " + Value::Number(objectiveValue).to_string();
+        }
+        output += "\n";
+
+        for (int i = 0; i < numRes; ++i) {
+            output += "x" + std::to_string(basis[i]+1);
+            output += " = " + Value::Number(baseValues[i]).to_string();
+            output += "\n";
+        }
+        output += "\n";
+        return output;
+    }
+
+    std::vector<double> Revised::getValues() const {
+        std::vector<double> values(numVar, 0);
+        for (int i = 0; i < numRes; ++i) {
+            values[basis[i]] = baseValues[i];
+        }
+        return values;
+    }
+
+};
\ No newline at end of file
@@ -0,0 +1,160 @@
+/**
+ * @file Revised.hxx
+ * @brief File implemented to define the revised simplex engine
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include "../Representation/LinearSystems/SparseSystem.hxx"
+#include "Factorization.hxx"
+#include "Pricing.hxx"
+#include "RatioTest.hxx"
+#include "AntiCycling.hxx"
+#include "Table.hxx"
+#include <string>
+#include <vector>
+
+namespace Solver {
+
+    /**
+     * Revised simplex over the same Big-M model as the Table
+     *
+     * The restrictions (a SparseSystem, with slack and artificial columns) are kept
+     * as they are, only the basis is factorized. Each iteration:
+     *  1 - Prices the non base columns with y = c_B B^-1 (real and M parts),
+     *      the pricing rule chooses the entering one
+     *  2 - Calculates only the entering column B^-1 a_q
+     *  3 - Runs the ratio test (see RatioTest) over it
+     *  4 - Updates the base values and the factorization
+     * so nothing of size restrictions x variables is written
+     */
+    class Revised : private PricingSource {
+
+        public:
+
+            Revised(LinearSystems::SparseSystem * toSolveModel);
+
+            /**
+             * Runs one iteration, returns:
+             *  WORK        - pivoted, not done yet
+             *  DONE        - optimal
+             *  NO_FRONTIER - unbounded
+             *  NON_VIABLE  - optimal with an artificial variable still positive
+             *  CYCLIC      - repeated a basis even after the perturbation (see AntiCycling)
+             */
+            status iterate();
+
+            // Summary of the last iteration
+            std::string to_string();
+
+            std::string getResults();
+
+            // Value of each variable (the column order), 0 for the non base ones
+            std::vector<double> getValues() const;
+
+            int getIterations() { return iterations; }
+
+            // Dual simplex pivots iterate did to get back to b >= 0 after the perturbation
+            int getRecoveryIterations() const { return recoveryIterations; }
+
+            LinearSystems::SparseSystem * getModel() { return model; }
+
+            Factorization & getFactorization() { return factorization; }
+
+            // How the entering column is chosen, Dantzig by default
+            void setPricing(pricingRule rule);
+
+            pricingRule getPricing() const { return pricing->getRule(); }
+
+            // Whether it had to perturb the system and move to Bland's rule
+            bool wasPerturbed() const { return antiCycling.isActive(); }
+
+            // Whether iterate stopped (NON_VIABLE) because the basis couldn't be factorized again
+            bool isSingular() const { return singular; }
+
+            static constexpr double OPTIMALITY_TOLERANCE = 1e-9;
+            static constexpr double PIVOT_TOLERANCE = 1e-9;
+
+        private:
+
+            // Returns false if the basis is singular
+            bool refactor();
+
+            // y = c_B B^-1, one for each part of the costs
+            void calculatePrices();
+
+            Value::Number reducedCost(int column) const;
+
+            // Perturbs the base values and moves to Bland's rule, once cycling or stalling is detected
+            void perturb();
+
+            // Back to the real b, once it's optimal, rounding left below 0 goes to 0
+            void removePerturbation();
+
+            /**
+             * Dual simplex pivots until no base value is below 0, false if one can't get there
+             * The base has to be dual feasible, as it is at the optimum of the perturbed system
+             */
+            bool restoreFeasibility();
+
+            // Base change of one iteration, theta being the value the entering column gets
+            void pivot(int line, double theta, const std::vector<double> &entering);
+
+            // What the pricing rules need besides the reduced costs (see Pricing.hxx)
+            bool isImproving(const Value::Number &cost) const { return isPositive(cost); }
+
+            bool isHigherCost(const Value::Number &first, const Value::Number &second) const {
+                return isHigher(first, second);
+            }
+
+            double columnNorm(int column) const;
+
+            void pivotRow(int line, std::vector<double> &row) const;
+
+            void columnDots(int column, std::vector<double> &dots) const;
+
+            static bool isPositive(const Value::Number &input);
+
+            static bool isHigher(const Value::Number &first, const Value::Number &second);
+
+            // Restrictions in equality form, never changed
+            LinearSystems::SparseSystem * model;
+
+            int numRes;
+            int numVar;
+
+            // basis[i] is the column of the base variable of line i, position is the inverse (-1 if not base)
+            std::vector<int> basis;
+            std::vector<int> position;
+            std::vector<double> baseValues;
+
+            // Non base columns, in no particular order, and where each one is on that list
+            std::vector<int> nonBasic;
+            std::vector<int> nonBasicPosition;
+
+            std::vector<double> prices;
+            std::vector<double> Mprices;
+
+            Factorization factorization;
+
+            std::shared_ptr<Pricing> pricing;
+
+            RatioTest ratioTest;
+
+            AntiCycling antiCycling;
+
+            // Added to b while perturbed (B times the perturbation of the base values), empty otherwise
+            std::vector<double> perturbation;
+
+            int iterations;
+            int recoveryIterations;
+            int enteringColumn;
+            int leavingColumn;
+            double lastTheta;
+
+            bool singular;
+    };
+
+};
@@ -0,0 +1,128 @@
+/**
+ * @file Scaling.cxx
+ * @brief File implemented to implement the scaling of the restrictions before the table is built
+ * @version 0.1
+ *
+ */
+
+#include "Scaling.hxx"
+#include <algorithm>
+#include <cmath>
+
+namespace Solver {
+
+    namespace {
+
+        struct entry {
+            int row;
+            int column;
+            double value;   // |a_ij|
+        };
+
+        double spread(const std::vector<entry> &entries, const std::vector<double> &rows,
+                      const std::vector<double> &columns) {
+            double largest = 0;
+            double smallest = 0;
+            for (const entry &item : entries) {
+                double value = item.value*rows[item.row]*columns[item.column];
+                largest = std::max(largest, value);
+                smallest = smallest == 0 ? value : std::min(smallest, value);
+            }
+            return smallest == 0 ? 1 : largest/smallest;
+        }
+
+        // Nearest power of 2, so multiplying by it is exact
+        double powerOfTwo(double factor) {
+            return std::exp2(std::round(std::log2(factor)));
+        }
+
+        /**
+         * One factor per line (rows) or per column, from the scaled values each one has:
+         * geometric: 1/sqrt(largest smallest), otherwise 1/largest. The kept ones stay as they are
+         */
+        void updateFactors(const std::vector<entry> &entries, const std::vector<double> &rows,
+                           const std::vector<double> &columns, bool byRow, bool geometric,
+                           const std::vector<bool> &kept, std::vector<double> &factors) {
+            std::vector<double> largest(factors.size(), 0);
+            std::vector<double> smallest(factors.size(), 0);
+            for (const entry &item : entries) {
+                int index = byRow ? item.row : item.column;
+                double value = item.value*rows[item.row]*columns[item.column]/factors[index];
+                largest[index] = std::max(largest[index], value);
+                smallest[index] = smallest[index] == 0 ? value : std::min(smallest[index], value);
+            }
+            for (std::size_t k = 0; k < factors.size(); ++k) {
+                if (largest[k] == 0 || kept[k]) {
+                    continue;
+                }
+                double factor = geometric ? 1/std::sqrt(largest[k]*smallest[k]) : 1/largest[k];
+                factors[k] = powerOfTwo(factor);
+            }
+        }
+
+    };
+
+    void Scaling::apply(LinearSystems::System * system) {
+        int numRes = system->getNumberOfRestrictions();
+        int numVar = system->getNumberOfVariables();
+        LinearSystems::Restriction * restrictions = system->getRestrictions();
+
+        std::vector<entry> entries;
+        std::vector<bool> keptRows(numRes, false);
+        std::vector<bool> keptColumns(numVar, false);
+        for (int i = 0; i < numRes; ++i) {
+            LinearSystems::restrictionItem * items = restrictions[i].getRestriction();
+            int symbol = static_cast<int>(items[numVar].second.getValue());
+            keptRows[i] = symbol != LinearSystems::LOWER_EQUAL && symbol != LinearSystems::HIGHER_EQUAL;
+            for (int j = 0; j < numVar; ++j) {
+                double value = std::fabs(items[j].second.getValue());
+                if (value != 0) {
+                    entries.push_back(entry{i, j, value});
+                    keptColumns[j] = keptColumns[j] || keptRows[i];
+                }
+            }
+        }
+
+        rows.assign(numRes, 1);
+        columns.assign(numVar, 1);
+        spreadBefore = spread(entries, rows, columns);
+
+        // 1 - Geometric mean, while it pays off
+        double current = spreadBefore;
+        for (int pass = 0; pass < GEOMETRIC_PASSES; ++pass) {
+            std::vector<double> newRows(rows);
+            std::vector<double> newColumns(columns);
+            updateFactors(entries, newRows, newColumns, true, true, keptRows, newRows);
+            updateFactors(entries, newRows, newColumns, false, true, keptColumns, newColumns);
+            double next = spread(entries, newRows, newColumns);
+            if (next > current*MINIMUM_GAIN) {
+                if (next < current) {
+                    rows.swap(newRows);
+                    columns.swap(newColumns);
+                }
+                break;
+            }
+            rows.swap(newRows);
+            columns.swap(newColumns);
+            current = next;
+        }
+
+        // 2 - Equilibration, rows then columns
+        updateFactors(entries, rows, columns, true, false, keptRows, rows);
+        updateFactors(entries, rows, columns, false, false, keptColumns, columns);
+        spreadAfter = spread(entries, rows, columns);
+
+        for (int i = 0; i < numRes; ++i) {
+            LinearSystems::restrictionItem * items = restrictions[i].getRestriction();
+            for (int j = 0; j < numVar; ++j) {
+                items[j].second = items[j].second*(rows[i]*columns[j]);
+            }
+            items[numVar+1].second = items[numVar+1].second*rows[i];
+        }
+        LinearSystems::restrictionItem * objective = system->getObjective()->getRestriction();
+        for (int j = 0; j < numVar; ++j) {
+            objective[j].second = objective[j].second*columns[j];
+        }
+    }
+
+};
@@ -0,0 +1,62 @@
+/**
+ * @file Scaling.hxx
+ * @brief File implemented to define the scaling of the restrictions before the table is built
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <vector>
+#include "../Representation/LinearSystems/System.hxx"
+
+namespace Solver {
+
+    /**
+     * Row and column factors that bring the coefficients close to 1, so
+     * the pivots aren't tiny next to the other values of their line:
+     *
+     *  a'_ij = r_i a_ij s_j      b'_i = r_i b_i      c'_j = s_j c_j      x_j = s_j x'_j
+     *
+     *  1 - Geometric mean passes: r_i = 1/sqrt(max_j |a_ij s_j| min_j |a_ij s_j|),
+     *      then the same for the columns, until the spread stops getting better
+     *  2 - Equilibration: the largest value of each row, then of each column, becomes 1
+     *
+     * Restrictions without a slack column (=, < and >) and the variables in them keep their
+     * values: the table takes its starting base from those lines as they were typed in
+     *
+     * Every factor is a power of 2, so scaling and unscaling don't round anything.
+     * The objective value is the same on both systems
+     */
+    class Scaling {
+
+        public:
+
+            // Scales the system in place, before any slack or artificial variable is added
+            void apply(LinearSystems::System * system);
+
+            bool isApplied() const { return !columns.empty(); }
+
+            // r_i and s_j
+            const std::vector<double> & getRowFactors() const { return rows; }
+            const std::vector<double> & getColumnFactors() const { return columns; }
+
+            // Largest over smallest |a_ij| (non zero), before and after apply
+            double getSpreadBefore() const { return spreadBefore; }
+            double getSpreadAfter() const { return spreadAfter; }
+
+            static const int GEOMETRIC_PASSES = 20;
+
+            // Stops once a pass takes less than this off the spread
+            static constexpr double MINIMUM_GAIN = 0.9;
+
+        private:
+
+            std::vector<double> rows;
+            std::vector<double> columns;
+
+            double spreadBefore;
+            double spreadAfter;
+    };
+
+};
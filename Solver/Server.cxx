@@ -0,0 +1,389 @@
+/**
+ * @file Server.cxx
+ * @brief File implemented to implement the solver server, answering requests on a Unix domain socket
+ * @version 0.1
+ *
+ */
+
+#include "Server.hxx"
+#include "Batch.hxx"
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <iostream>
+#include <utility>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace Solver {
+
+    namespace {
+
+        volatile std::sig_atomic_t stopRequested = 0;
+
+        void requestStop(int) {
+            stopRequested = 1;
+        }
+
+        std::string hexadecimal(std::uint64_t value) {
+            char text[17];
+            std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(value));
+            return text;
+        }
+
+        // Header line of a request, false if it isn't one
+        bool readHeader(const std::vector<std::string_view> &tokens, solveOptions &options,
+                        Readers::modelFormat &format, std::vector< std::pair<int, double> > &rightSides,
+                        bool &withValues, std::string &id) {
+            std::string_view key = tokens[0];
+            if (key == "format" && tokens.size() == 2) {
+                format = tokens[1] == "lp" ? Readers::CPLEX_LP :
+                         tokens[1] == "mps" ? Readers::FREE_MPS :
+                         tokens[1] == "fixed-mps" ? Readers::FIXED_MPS : Readers::UNKNOWN_FORMAT;
+                return format != Readers::UNKNOWN_FORMAT;
+            } else if (key == "engine" && tokens.size() == 2) {
+                if (tokens[1] == "tableau") {
+                    options.engine = TABLEAU;
+                } else if (tokens[1] == "revised") {
+                    options.engine = REVISED;
+                } else if (tokens[1] == "two-phase") {
+                    options.engine = TWO_PHASE;
+                } else {
+                    return false;
+                }
+                return true;
+            } else if (key == "pricing" && tokens.size() == 2) {
+                return pricingFromName(std::string(tokens[1]), options.pricing);
+            } else if (key == "rhs" && tokens.size() == 3) {
+                double line;
+                double value;
+                if (!Readers::toDouble(tokens[1], line) || !Readers::toDouble(tokens[2], value) ||
+                    line < 1 || line != std::floor(line)) {
+                    return false;
+                }
+                rightSides.push_back(std::make_pair(static_cast<int>(line) - 1, value));
+                return true;
+            } else if (key == "values" && tokens.size() == 1) {
+                withValues = true;
+                return true;
+            } else if (key == "id" && tokens.size() == 2) {
+                id = std::string(tokens[1]);
+                return true;
+            }
+            return false;
+        }
+
+    };
+
+#ifndef _WIN32
+
+    struct Server::connection {
+        int socket;
+
+        // Bytes read that aren't a whole frame yet, only the reading thread touches them
+        std::string pending;
+
+        // Workers answering on the same connection write one whole frame at a time
+        std::mutex writing;
+
+        connection(int socket) : socket(socket) {}
+
+        ~connection() { close(socket); }
+    };
+
+    namespace {
+
+        // The client may be gone, its answer is then dropped
+        void writeFrame(int socket, const std::string &payload) {
+            std::uint32_t size = payload.size();
+            unsigned char header[4] = {static_cast<unsigned char>(size), static_cast<unsigned char>(size >> 8),
+                                       static_cast<unsigned char>(size >> 16), static_cast<unsigned char>(size >> 24)};
+            std::string frame(reinterpret_cast<char *>(header), 4);
+            frame += payload;
+            std::size_t written = 0;
+            while (written < frame.size()) {
+                ssize_t count = write(socket, frame.data() + written, frame.size() - written);
+                if (count < 0 && errno == EINTR) {
+                    continue;
+                } else if (count <= 0) {
+                    return;
+                }
+                written += count;
+            }
+        }
+
+    };
+
+#endif
+
+    Server::Server(const std::string &path, int threads, int cacheSize, const solveOptions &defaults) :
+        path(path), threadCount(threads < 1 ? 1 : threads), defaults(defaults), cache(cacheSize),
+        stopping(false), answered(0) {
+
+    }
+
+    Server::~Server() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        queued.notify_all();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    std::string Server::answer(const std::string &request) {
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        batchResult result{"", solveResult(), 0};
+        solveResult &solved = result.result;
+        solveOptions options = defaults;
+        Readers::modelFormat format = Readers::CPLEX_LP;
+        std::vector< std::pair<int, double> > rightSides;
+        bool withValues = false;
+        std::string id;
+        bool cached = false;
+
+        // Header, up to the empty line
+        std::string_view text(request);
+        std::vector<std::string_view> tokens;
+        std::size_t position = 0;
+        while (solved.error.empty()) {
+            std::size_t end = text.find('\n', position);
+            if (end == std::string_view::npos) {
+                solved.error = "the request has no empty line between the header and the model";
+                break;
+            }
+            std::string_view line = text.substr(position, end - position);
+            position = end + 1;
+            Readers::split(line, tokens);
+            if (tokens.empty()) {
+                break;
+            }
+            if (!readHeader(tokens, options, format, rightSides, withValues, id)) {
+                solved.error = "invalid header line: " + std::string(line);
+            }
+        }
+
+        std::shared_ptr<cachedModel> model;
+        if (solved.error.empty()) {
+            std::string_view modelText = text.substr(position);
+            std::uint64_t hash = ModelCache::hash(modelText) ^ static_cast<std::uint64_t>(format);
+            result.model = hexadecimal(hash);
+            model = cache.find(hash);
+            cached = model != nullptr;
+            if (!cached) {
+                LinearSystems::System * system = Readers::readModelText(modelText, format, solved.error);
+                if (system != nullptr) {
+                    model = cache.insert(hash, system);
+                }
+            }
+        }
+
+        if (model != nullptr) {
+            LinearSystems::System * system = model->system->copy();
+            int variables = system->getNumberOfVariables();
+            for (const std::pair<int, double> &change : rightSides) {
+                if (change.first >= system->getNumberOfRestrictions()) {
+                    solved.error = "there is no restriction " + std::to_string(change.first + 1);
+                    break;
+                }
+                system->getRestrictions()[change.first].getRestriction()[variables+1].second = Value::Number(change.second);
+            }
+            if (solved.error.empty()) {
+                if (options.engine == TABLEAU && !options.presolve) {
+                    options.basis = cache.getBasis(*model);
+                }
+                solved = solve(system, options);
+                if (!solved.basis.empty()) {
+                    cache.setBasis(*model, solved.basis);
+                }
+            }
+            delete system;
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        ++answered;
+
+        // Same line as the batch, with the fields of the server before the closing brace
+        std::string output = Batch::to_json(result, withValues);
+        output.pop_back();
+        if (!id.empty()) {
+            output += ", \"id\": \"" + Batch::escape(id) + "\"";
+        }
+        output += std::string(", \"cached\": ") + (cached ? "true" : "false");
+        output += std::string(", \"warm\": ") + (solved.warmStarted ? "true" : "false");
+        return output + "}";
+    }
+
+#ifdef _WIN32
+
+    bool Server::run(std::string &error) {
+        error = "the server needs Unix domain sockets, it isn't available on Windows";
+        return false;
+    }
+
+    void Server::workerLoop() {
+
+    }
+
+    bool Server::readFrames(const std::shared_ptr<connection> &client) {
+        return false;
+    }
+
+#else
+
+    void Server::workerLoop() {
+        while (true) {
+            job next;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                queued.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) {
+                    return;
+                }
+                next = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            std::string output = answer(next.request);
+            std::lock_guard<std::mutex> lock(next.client->writing);
+            writeFrame(next.client->socket, output);
+        }
+    }
+
+    bool Server::readFrames(const std::shared_ptr<connection> &client) {
+        char block[1 << 16];
+        ssize_t count = read(client->socket, block, sizeof(block));
+        if (count < 0 && errno == EINTR) {
+            return true;
+        } else if (count <= 0) {
+            return false;
+        }
+        std::string &pending = client->pending;
+        pending.append(block, count);
+
+        std::size_t position = 0;
+        while (pending.size() - position >= 4) {
+            const unsigned char * header = reinterpret_cast<const unsigned char *>(pending.data() + position);
+            std::uint32_t size = header[0] | (header[1] << 8) | (header[2] << 16) |
+                                 (static_cast<std::uint32_t>(header[3]) << 24);
+            if (size > MAX_FRAME) {
+                return false;
+            }
+            if (pending.size() - position - 4 < size) {
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                jobs.push_back(job{client, pending.substr(position + 4, size)});
+            }
+            queued.notify_one();
+            position += 4 + size;
+        }
+        pending.erase(0, position);
+        return true;
+    }
+
+    bool Server::run(std::string &error) {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            error = "the socket path is too long: " + path;
+            return false;
+        }
+        std::strcpy(address.sun_path, path.c_str());
+
+        // A socket left by a server that didn't end well, anything else stays
+        struct stat status;
+        if (lstat(path.c_str(), &status) == 0) {
+            if (!S_ISSOCK(status.st_mode)) {
+                error = path + " exists and isn't a socket";
+                return false;
+            }
+            unlink(path.c_str());
+        }
+
+        int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) {
+            error = std::string("could not create the socket: ") + std::strerror(errno);
+            return false;
+        }
+        if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+            listen(listener, SOMAXCONN) < 0) {
+            error = "could not listen on " + path + ": " + std::strerror(errno);
+            close(listener);
+            return false;
+        }
+
+        stopRequested = 0;
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+        // A client leaving before its answer must not end the server
+        std::signal(SIGPIPE, SIG_IGN);
+
+        for (int i = 0; i < threadCount; ++i) {
+            workers.emplace_back(&Server::workerLoop, this);
+        }
+        std::cout << "Listening on " << path << " with " << threadCount << " workers" << std::endl;
+
+        std::vector< std::shared_ptr<connection> > clients;
+        std::vector<pollfd> polled;
+        while (!stopRequested) {
+            polled.assign(1, pollfd{listener, POLLIN, 0});
+            for (const std::shared_ptr<connection> &client : clients) {
+                polled.push_back(pollfd{client->socket, POLLIN, 0});
+            }
+            // Wakes up now and then to see if it was asked to stop
+            int ready = poll(polled.data(), polled.size(), 200);
+            if (ready < 0 && errno != EINTR) {
+                error = std::string("poll failed: ") + std::strerror(errno);
+                break;
+            } else if (ready <= 0) {
+                continue;
+            }
+
+            // Backwards, so the clients that are gone can be dropped on the way
+            for (std::size_t i = polled.size() - 1; i > 0; --i) {
+                if (polled[i].revents != 0 && !readFrames(clients[i-1])) {
+                    clients.erase(clients.begin() + (i-1));
+                }
+            }
+            if (polled[0].revents & POLLIN) {
+                int accepted = accept(listener, nullptr, nullptr);
+                if (accepted >= 0) {
+                    clients.push_back(std::shared_ptr<connection>(new connection(accepted)));
+                }
+            }
+        }
+
+        clients.clear();
+        close(listener);
+        unlink(path.c_str());
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        queued.notify_all();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+
+        std::cout << "Answered " << answered << " requests, " << cache.getMisses() << " models parsed and "
+                  << cache.getHits() << " taken from the cache" << std::endl;
+        return error.empty();
+    }
+
+#endif
+
+};
@@ -0,0 +1,110 @@
+/**
+ * @file Server.hxx
+ * @brief File implemented to define the solver server, answering requests on a Unix domain socket
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Solve.hxx"
+#include "ModelCache.hxx"
+
+namespace Solver {
+
+    /**
+     * Long running solver, for many solves of small variations of the same few models
+     * without starting a process and parsing the model each time
+     *
+     * Every message, both ways, is a frame: u32 length (little endian) and that many bytes
+     * A request is a few header lines, an empty line and then the model:
+     *
+     *  format lp           lp (default), mps or fixed-mps
+     *  engine tableau      tableau, revised or two-phase (default: the ones the server was started with)
+     *  pricing devex       see pricingFromName
+     *  rhs 2 14            b of restriction 2 (1 based, as in the model) is 14 for this solve only
+     *  values              the answer has the value of every variable
+     *  id 17               given back as is, to match the answers with the requests
+     *
+     *  Maximize
+     *   ...
+     *
+     * The answer is a batch line (see Batch::to_json) with the hash of the model as the model,
+     * plus "cached" (it didn't have to be parsed) and "warm" (the table engine started from the
+     * basis the last optimal solve of that model ended on):
+     *
+     *  {"model": "9f3c0a...", "status": "DONE", ..., "id": "17", "cached": true, "warm": true}
+     *
+     * One thread reads every connection and queues each whole request, the workers solve them
+     * and write the answers, so a connection sending several requests may get them out of order
+     */
+    class Server {
+
+        public:
+
+            /**
+             * threads: requests solved at the same time, each one on a single thread
+             * cacheSize: parsed models kept (see ModelCache)
+             * defaults: what a request doesn't set
+             */
+            Server(const std::string &path, int threads = 1, int cacheSize = 64,
+                   const solveOptions &defaults = solveOptions());
+
+            ~Server();
+
+            Server(const Server &) = delete;
+            Server& operator=(const Server &) = delete;
+
+            /**
+             * Serves until SIGINT or SIGTERM, the requests already queued are still answered
+             * False if it couldn't listen on the path, with the reason in error
+             */
+            bool run(std::string &error);
+
+            // Answer to the payload of one request frame, what each worker does
+            std::string answer(const std::string &request);
+
+            // Larger frames close the connection
+            static const std::uint32_t MAX_FRAME = 1u << 28;
+
+        private:
+
+            // Socket of a client, closed once the reader and the workers are done with it
+            struct connection;
+
+            struct job {
+                std::shared_ptr<connection> client;
+                std::string request;
+            };
+
+            void workerLoop();
+
+            // Whole frames read so far go to the queue, false once the client is gone
+            bool readFrames(const std::shared_ptr<connection> &client);
+
+            std::string path;
+            int threadCount;
+            solveOptions defaults;
+
+            ModelCache cache;
+
+            std::vector<std::thread> workers;
+
+            std::mutex queueMutex;
+            std::condition_variable queued;
+            std::deque<job> jobs;
+            bool stopping;
+
+            std::atomic<long> answered;
+    };
+
+};
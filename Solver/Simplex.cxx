@@ -12,24 +12,13 @@
 #include <iostream>
 
 #include "Simplex.hxx"
+#include "Basis.hxx"
 #include "../Helpers/Helper.hxx"
 
 namespace Solver {
 
-    std::map<status, std::string> statusToString {
-        // Simplex status
-        {WORK, std::string("WORK")},
-        {DONE, std::string("DONE")},
-        {NO_FRONTIER, std::string("NO_FRONTIER")},
-        {NON_VIABLE, std::string("NON_VIABLE")},
-        {DEGENERATED, std::string("DEGENERATED")},
-        {ALTERNATED_OPTIMAL, std::string("ALTERNATED_OPTIMAL")},
-        {CYCLIC, std::string("CYCLIC")}
-    };
+    Simplex::Simplex(int threads, engineType engine, pricingRule pricing) : presolve(nullptr) {
 
-    Simplex::Simplex() {
-
-        resolutionOrder = static_cast<Table*>(malloc(sizeof(Table) * 100));
         std::string input;
         bool inputNotValid = true;
         selectedOption = 0;
@@ -48,8 +37,39 @@ namespace Solver {
             }
         }
         // Populate system
-        LinearSystems::System * toSolveSystem = new LinearSystems::System();
-        tableInstance = new Table(toSolveSystem);
+        LinearSystems::System * system = new LinearSystems::System();
+        start(system, threads, engine, pricing);
+        delete system;
+    }
+
+    Simplex::Simplex(LinearSystems::System * toSolveSystem, resolutionOption option, int threads,
+                     engineType engine, pricingRule pricing, Presolve * presolve) : presolve(presolve) {
+        chosenOption = option;
+        selectedOption = static_cast<int>(option);
+        start(toSolveSystem, threads, engine, pricing);
+    }
+
+    Simplex::Simplex(Table * table, resolutionOption option, int threads, pricingRule pricing,
+                     const std::vector<modification> &changes, const std::string &basisPath,
+                     Presolve * presolve) : changes(changes), basisPath(basisPath), presolve(presolve) {
+        chosenOption = option;
+        selectedOption = static_cast<int>(option);
+        tableInstance = table;
+        tableInstance->setThreadCount(threads);
+        tableInstance->setPricing(pricing);
+        solverMain();
+    }
+
+    void Simplex::start(LinearSystems::System * toSolveSystem, int threads, engineType engine, pricingRule pricing) {
+        if (engine == REVISED) {
+            revisedInstance = new Revised(new LinearSystems::SparseSystem(toSolveSystem));
+            revisedInstance->setPricing(pricing);
+            solverMainRevised();
+            return;
+        }
+        tableInstance = new Table(toSolveSystem, engine == TWO_PHASE);
+        tableInstance->setThreadCount(threads);
+        tableInstance->setPricing(pricing);
         solverMain();
     }
 
@@ -75,17 +95,20 @@ namespace Solver {
         */
 
         status solutionStatus = status::WORK;
-        bool isPreviousNoFrontier = false;
+        bool isAlternatedShown = false;
+        status thetaStatus = status::WORK;
         iterations = 0;
-        std::string a;
         std::string outputString;
-        system(CLEAR_COMMAND);
+        Helper::clearScreen();
         std::cout << tableInstance->getSystemToSolve()->to_string() << std::endl;
+        if (!solverMainFeasible()) {
+            delete tableInstance;
+            return;
+        }
         while (solutionStatus != DONE) {
 
             if (selectedOption == 3) {
-                std::cout << "Input: ";
-                std::cin >> a;
+                waitInput();
             }
             // std::cout << "calculateCjZj" << std::endl;
 
@@ -93,40 +116,41 @@ namespace Solver {
             // std::cout << "evaluateCjZj" << std::endl;
             solutionStatus = tableInstance->evaluateCjZj();
             if (solutionStatus == ALTERNATED_OPTIMAL) {
+                if (isAlternatedShown) {
+                    // Back to an optimal solution, both were shown already
+                    break;
+                }
                 std::cout << tableInstance->getResults(true) << std::endl;
+                isAlternatedShown = true;
             }  else if (solutionStatus == NON_VIABLE) {
                 std::cout << "The code has a non viable solution, ending the program..." << std::endl;
                 break;
             }
 
-            if (solutionStatus != DONE) {
-                solutionStatus = tableInstance->calculateTheta();
-            } else {
-                tableInstance->calculateTheta();
-            }
-            
+            thetaStatus = tableInstance->calculateTheta();
+
             // std::cout << "calculateTheta" << std::endl;
             // If user wants every iteration, give him that
             if (selectedOption == 2 || selectedOption == 3) {
                 std::cout << tableInstance->to_string() << std::endl;
             }
 
-            if (isPreviousNoFrontier) {
-                break;
-            }
-
             if (solutionStatus == DONE) {
                 continue;
-            } else if (solutionStatus == DEGENERATED) {
-                std::cout << "Degenerated system detected, stopping..." << std::endl;
+            } else if (thetaStatus == NO_FRONTIER && solutionStatus == ALTERNATED_OPTIMAL) {
+                // The other optimal solutions go on forever, this one is as good as any
                 break;
-            }  else if (solutionStatus == NO_FRONTIER) {
+            } else if (thetaStatus == NO_FRONTIER) {
                 std::cout << "No frontier system detected, no solution available here" << std::endl;
-                isPreviousNoFrontier = true;
+                solutionStatus = NO_FRONTIER;
+                break;
+            } else if (thetaStatus == CYCLIC) {
+                std::cout << "Cyclic system detected, stopping..." << std::endl;
+                solutionStatus = CYCLIC;
+                break;
             }
-            // Save current table before next iteration
-            Table toSave = *tableInstance;
-            resolutionOrder[iterations] = toSave;
+            // Save what this iteration does before it's done
+            history.record(*tableInstance);
             ++iterations;
 
             // IF DONE WE CANNOT ALTER AGAIN
@@ -142,13 +166,173 @@ namespace Solver {
         if (solutionStatus == DONE || solutionStatus == ALTERNATED_OPTIMAL) {
             // std::cout << "Status = " << solutionStatus << std::endl;
             std::cout << std::endl  << "Finished! The final status is " 
-                                    << statusToString[solutionStatus] << std::endl << std::endl;
+                                    << to_string(solutionStatus) << std::endl << std::endl;
             std::cout << tableInstance->to_string() << std::endl;
 
             std::cout << tableInstance->getResults() << std::endl;
+            if (tableInstance->wasPerturbed()) {
+                std::cout << "Degenerate pivots kept it from moving, it was perturbed and finished with Bland's rule" << std::endl;
+            }
+            std::cout << "Iterations: " << iterations + tableInstance->getRecoveryIterations()
+                      << " (" << to_string(tableInstance->getPricing())
+                      << " pricing)" << std::endl;
+            if (presolve != nullptr) {
+                std::cout << std::endl << presolve->getResults(tableInstance->getValues()) << std::endl;
+            }
+
+            bool isSolved = changes.empty() || solverMainDual();
+            std::string error;
+            if (isSolved && !basisPath.empty() && !Basis::save(basisPath, tableInstance, error)) {
+                std::cout << "Could not save the basis: " << error << std::endl;
+            }
         }
 
         delete tableInstance;
     }
 
-}; 
\ No newline at end of file
+    void Simplex::waitInput() {
+        std::string input;
+        int iteration = 0;
+        while (true) {
+            std::cout << "Input: ";
+            if (!(std::cin >> input)) {
+                return;
+            }
+            iteration = 0;
+            if (!input.empty() && input.size() < 10) {
+                Helper::isAllDigits(input, iteration);
+            }
+            if (iteration < 1) {
+                return;
+            }
+            // Iterations are shown from 1
+            Tableau past;
+            std::vector<int> base;
+            std::string error;
+            if (!history.matches(*tableInstance)) {
+                std::cout << "Could not show it: the table changed since then (end of phase one)" << std::endl;
+            } else if (iteration-1 < history.getFirst() || iteration > history.getSize()) {
+                std::cout << "Could not show it: only iterations " << history.getFirst()+1 << " to "
+                          << history.getSize() << " are kept" << std::endl;
+            } else if (history.rebuild(iteration-1, past, base, error)) {
+                std::cout << "Iteration " << iteration << ":" << std::endl
+                          << tableInstance->to_string(past, base) << std::endl;
+            } else {
+                std::cout << "Could not show it: " << error << std::endl;
+            }
+        }
+    }
+
+    bool Simplex::solverMainFeasible() {
+        if (tableInstance->isPrimalFeasible()) {
+            return true;
+        }
+        DualSimplex dual(tableInstance);
+        status solutionStatus = status::WORK;
+        while (solutionStatus == WORK) {
+            solutionStatus = dual.iterate();
+        }
+        if (solutionStatus == NON_VIABLE) {
+            std::cout << "The code has a non viable solution, ending the program..." << std::endl;
+            return false;
+        }
+        std::cout << "The imported basis took " << dual.getIterations()
+                  << " dual iteration(s) to be feasible again" << std::endl;
+        return true;
+    }
+
+    bool Simplex::solverMainDual() {
+        DualSimplex dual(tableInstance);
+        std::string error;
+        for (const modification &change : changes) {
+            if (!dual.apply(change, error)) {
+                std::cout << "Could not change the system: " << error << std::endl;
+                return false;
+            }
+        }
+        std::cout << std::endl << "Solving again after " << changes.size() << " change(s), with the dual simplex"
+                  << std::endl << std::endl;
+
+        status solutionStatus = status::WORK;
+        std::string a;
+        while (solutionStatus == WORK) {
+
+            if (selectedOption == 3) {
+                std::cout << "Input: ";
+                std::cin >> a;
+            }
+
+            solutionStatus = dual.iterate();
+
+            if (solutionStatus == WORK && (selectedOption == 2 || selectedOption == 3)) {
+                tableInstance->calculateCjZj();
+                std::cout << tableInstance->to_string() << std::endl;
+            }
+        }
+
+        if (solutionStatus == NON_VIABLE) {
+            std::cout << "The code has a non viable solution, ending the program..." << std::endl;
+            return false;
+        }
+        std::cout << "Finished! The final status is " << to_string(solutionStatus) << std::endl << std::endl;
+        std::cout << tableInstance->to_string() << std::endl;
+        std::cout << tableInstance->getResults() << std::endl;
+        std::cout << "Dual iterations: " << dual.getIterations() << std::endl;
+        return true;
+    }
+
+    void Simplex::solverMainRevised() {
+        /**
+         * Same steps as solverMain, but each iteration only shows
+         * which variables changed, there is no table to print
+         */
+        status solutionStatus = status::WORK;
+        iterations = 0;
+        std::string a;
+        Helper::clearScreen();
+        std::cout << revisedInstance->getModel()->getSystem()->to_string() << std::endl;
+        while (solutionStatus == WORK) {
+
+            if (selectedOption == 3) {
+                std::cout << "Input: ";
+                std::cin >> a;
+            }
+
+            solutionStatus = revisedInstance->iterate();
+
+            if (solutionStatus == WORK) {
+                ++iterations;
+                if (selectedOption == 2 || selectedOption == 3) {
+                    std::cout << revisedInstance->to_string() << std::endl;
+                }
+            }
+        }
+
+        if (solutionStatus == DONE) {
+            std::cout << std::endl  << "Finished! The final status is "
+                                    << to_string(solutionStatus) << std::endl << std::endl;
+            std::cout << revisedInstance->getResults() << std::endl;
+            if (revisedInstance->wasPerturbed()) {
+                std::cout << "Degenerate pivots kept it from moving, it was perturbed and finished with Bland's rule" << std::endl;
+            }
+            std::cout << "Iterations: " << iterations + revisedInstance->getRecoveryIterations()
+                      << " (" << to_string(revisedInstance->getPricing())
+                      << " pricing)" << std::endl;
+            if (presolve != nullptr) {
+                std::cout << std::endl << presolve->getResults(revisedInstance->getValues()) << std::endl;
+            }
+        } else if (solutionStatus == NON_VIABLE && revisedInstance->isSingular()) {
+            std::cout << "Singular basis found while refactorizing" << std::endl;
+        } else if (solutionStatus == NON_VIABLE) {
+            std::cout << "The code has a non viable solution, ending the program..." << std::endl;
+        } else if (solutionStatus == NO_FRONTIER) {
+            std::cout << "No frontier system detected, no solution available here" << std::endl;
+        } else if (solutionStatus == CYCLIC) {
+            std::cout << "Cyclic system detected, stopping..." << std::endl;
+        }
+
+        delete revisedInstance->getModel();
+        delete revisedInstance;
+    }
+
+};
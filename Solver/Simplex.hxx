@@ -13,6 +13,12 @@
 
 #include "../Representation/LinearSystems/System.hxx"
 #include "Table.hxx"
+#include "Revised.hxx"
+#include "DualSimplex.hxx"
+#include "Presolve.hxx"
+#include "Solve.hxx"
+#include "History.hxx"
+#include <string>
 #include <vector>
 
 namespace Solver {
@@ -27,7 +33,31 @@ namespace Solver {
 
         public:
     
-            Simplex();
+            /**
+             * threads: how many threads the table uses for each iteration
+             * engine: which engine solves the system
+             * pricing: how the entering column is chosen
+             */
+            Simplex(int threads = 1, engineType engine = TABLEAU, pricingRule pricing = DANTZIG);
+
+            /**
+             * Solves a system that was already loaded (from a model file), no menu is shown
+             * presolve: the one that reduced this system, the solution is also shown in the
+             * original variables (nullptr if there was none)
+             */
+            Simplex(LinearSystems::System * toSolveSystem, resolutionOption option = RESULT_ONLY,
+                    int threads = 1, engineType engine = TABLEAU, pricingRule pricing = DANTZIG,
+                    Presolve * presolve = nullptr);
+
+            /**
+             * Goes on solving a table that is already built (from a snapshot for example)
+             * changes: applied once it's solved, the dual simplex then solves it again
+             * basisPath: where the final basis is saved (see Basis), empty for nowhere
+             */
+            Simplex(Table * table, resolutionOption option = RESULT_ONLY, int threads = 1,
+                    pricingRule pricing = DANTZIG,
+                    const std::vector<modification> &changes = std::vector<modification>(),
+                    const std::string &basisPath = std::string(), Presolve * presolve = nullptr);
 
             ~Simplex();
 
@@ -35,13 +65,35 @@ namespace Solver {
 
             resolutionOption chosenOption;
 
+            void start(LinearSystems::System * toSolveSystem, int threads, engineType engine, pricingRule pricing);
+
             void solverMain();
 
+            void solverMainRevised();
+
+            // Applies the changes to the solved table and solves it again with the dual simplex
+            bool solverMainDual();
+
+            // An imported basis may start off b >= 0, the dual simplex takes it back there first
+            bool solverMainFeasible();
+
+            // Waits for the input of the paused mode, a number shows the table of that iteration again
+            void waitInput();
+
+            std::vector<modification> changes;
+
+            std::string basisPath;
+
+            Presolve * presolve;
+
+            Revised * revisedInstance;
+
             Table * tableInstance;
 
             int iterations;
 
-            Table * resolutionOrder;
+            // Iterations of the table, the step by step modes can show any of them again
+            History history;
             
             int selectedOption;
     };
@@ -0,0 +1,427 @@
+/**
+ * @file Snapshot.cxx
+ * @brief File implemented to define the binary snapshot of a system and its table
+ * @version 0.1
+ *
+ */
+
+#include "Snapshot.hxx"
+#include "../Helpers/MappedFile.hxx"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Solver {
+
+    namespace {
+
+        const char MAGIC[8] = {'L', 'S', 'O', 'S', 'N', 'A', 'P', '\0'};
+
+        const std::uint32_t HAS_TABLE = 1;
+
+        // Fields are little endian in the file, swap them on big endian machines
+        template <typename T>
+        void toLittleEndian(unsigned char (&bytes)[sizeof(T)]) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            std::reverse(bytes, bytes + sizeof(T));
+#else
+            (void) bytes;
+#endif
+        }
+
+        class Writer {
+
+            public:
+
+                template <typename T>
+                void put(T value) {
+                    unsigned char bytes[sizeof(T)];
+                    std::memcpy(bytes, &value, sizeof(T));
+                    toLittleEndian<T>(bytes);
+                    data.insert(data.end(), bytes, bytes + sizeof(T));
+                }
+
+                // Next array starts on 8 bytes
+                void align() {
+                    while (data.size() % 8 != 0) {
+                        data.push_back(0);
+                    }
+                }
+
+                std::vector<unsigned char> data;
+        };
+
+        /**
+         * Reads the fields straight from the mapped file, never past its end
+         */
+        class Cursor {
+
+            public:
+
+                Cursor(const char * data, std::size_t size) : data(data), size(size), position(0) {}
+
+                template <typename T>
+                bool get(T &value) {
+                    if (size - position < sizeof(T)) {
+                        return false;
+                    }
+                    unsigned char bytes[sizeof(T)];
+                    std::memcpy(bytes, data + position, sizeof(T));
+                    toLittleEndian<T>(bytes);
+                    std::memcpy(&value, bytes, sizeof(T));
+                    position += sizeof(T);
+                    return true;
+                }
+
+                bool align() {
+                    position = std::min(size, (position + 7) & ~static_cast<std::size_t>(7));
+                    return true;
+                }
+
+                std::size_t remaining() const { return size - position; }
+
+            private:
+
+                const char * data;
+                std::size_t size;
+                std::size_t position;
+        };
+
+        /**
+         * Non zero cells of a rows x columns matrix, column by column
+         * cell(i, j) gives the Number on line i, column j
+         */
+        template <typename Cell>
+        void putColumns(Writer &writer, int rows, int columns, Cell cell) {
+            std::vector<std::int64_t> starts(columns+1, 0);
+            std::vector<std::int32_t> lines;
+            std::vector<double> values;
+            std::vector<double> mValues;
+
+            for (int j = 0; j < columns; ++j) {
+                for (int i = 0; i < rows; ++i) {
+                    Value::Number item = cell(i, j);
+                    if (item.getValue() == 0 && item.getMvalue() == 0) {
+                        continue;
+                    }
+                    lines.push_back(i);
+                    values.push_back(item.getValue());
+                    mValues.push_back(item.getMvalue());
+                }
+                starts[j+1] = lines.size();
+            }
+
+            for (std::int64_t start : starts) {
+                writer.put(start);
+            }
+            for (std::int32_t line : lines) {
+                writer.put(line);
+            }
+            writer.align();
+            for (double value : values) {
+                writer.put(value);
+            }
+            for (double value : mValues) {
+                writer.put(value);
+            }
+        }
+
+        /**
+         * Reads what putColumns wrote, calling set(i, j, Number) for each stored cell
+         */
+        template <typename Setter>
+        bool getColumns(Cursor &cursor, int rows, int columns, Setter set, std::string &error) {
+            std::vector<std::int64_t> starts(columns+1);
+            for (std::int64_t &start : starts) {
+                if (!cursor.get(start)) {
+                    error = "The snapshot is truncated";
+                    return false;
+                }
+            }
+            std::int64_t count = starts[columns];
+            if (starts[0] != 0 || count < 0 || static_cast<std::uint64_t>(count) > cursor.remaining()) {
+                error = "The snapshot has invalid column starts";
+                return false;
+            }
+            for (int j = 0; j < columns; ++j) {
+                if (starts[j+1] < starts[j]) {
+                    error = "The snapshot has invalid column starts";
+                    return false;
+                }
+            }
+
+            std::vector<std::int32_t> lines(count);
+            for (std::int32_t &line : lines) {
+                if (!cursor.get(line) || line < 0 || line >= rows) {
+                    error = "The snapshot has an invalid line index";
+                    return false;
+                }
+            }
+            cursor.align();
+            std::vector<double> values(count);
+            std::vector<double> mValues(count);
+            for (double &value : values) {
+                if (!cursor.get(value)) {
+                    error = "The snapshot is truncated";
+                    return false;
+                }
+            }
+            for (double &value : mValues) {
+                if (!cursor.get(value)) {
+                    error = "The snapshot is truncated";
+                    return false;
+                }
+            }
+
+            for (int j = 0; j < columns; ++j) {
+                for (std::int64_t k = starts[j]; k < starts[j+1]; ++k) {
+                    set(lines[k], j, Value::Number(values[k], mValues[k]));
+                }
+            }
+            return true;
+        }
+
+    };
+
+    bool Snapshot::save(const std::string &path, LinearSystems::System * system,
+                        const Table * table, std::string &error) {
+        int restrictions = system->getNumberOfRestrictions();
+        int variables = system->getNumberOfVariables();
+        LinearSystems::restrictionItem * objective = system->getObjective()->getRestriction();
+        LinearSystems::Restriction * lines = system->getRestrictions();
+
+        Writer writer;
+        writer.data.insert(writer.data.end(), MAGIC, MAGIC + sizeof(MAGIC));
+        writer.put<std::uint32_t>(VERSION);
+        writer.put<std::uint32_t>(table != nullptr ? HAS_TABLE : 0);
+        writer.put<std::uint32_t>(system->getAction());
+        writer.put<std::int32_t>(restrictions);
+        writer.put<std::int32_t>(variables);
+        writer.put<std::uint32_t>(0);
+
+        // System
+        for (int j = 0; j < variables; ++j) {
+            writer.put<std::int32_t>(objective[j].first);
+        }
+        writer.align();
+        for (int j = 0; j < variables; ++j) {
+            writer.put(objective[j].second.getValue());
+        }
+        for (int j = 0; j < variables; ++j) {
+            writer.put(objective[j].second.getMvalue());
+        }
+        for (int i = 0; i < restrictions; ++i) {
+            writer.put<std::int32_t>(lines[i].getRestriction()[variables].second.getValue());
+        }
+        writer.align();
+        for (int i = 0; i < restrictions; ++i) {
+            writer.put(lines[i].getRestriction()[variables+1].second.getValue());
+        }
+        for (int i = 0; i < restrictions; ++i) {
+            writer.put(lines[i].getRestriction()[variables+1].second.getMvalue());
+        }
+        putColumns(writer, restrictions, variables, [lines](int i, int j) {
+            return lines[i].getRestriction()[j].second;
+        });
+
+        // Table
+        if (table != nullptr) {
+            const Tableau &tableau = table->getTable();
+            const baseVariableItem * bases = table->getBaseVariables();
+            writer.put<std::int32_t>(tableau.getRows());
+            writer.put<std::int32_t>(tableau.getColumns());
+            writer.put<std::int32_t>(table->getIterationCount());
+            writer.put<std::int32_t>(tableau.hasMPlane());
+            for (int i = 0; i < restrictions; ++i) {
+                writer.put<std::int32_t>(bases[i].index);
+            }
+            for (int i = 0; i < restrictions; ++i) {
+                writer.put<std::int32_t>(bases[i].value.first);
+            }
+            writer.align();
+            for (int i = 0; i < restrictions; ++i) {
+                writer.put(bases[i].value.second.getValue());
+            }
+            for (int i = 0; i < restrictions; ++i) {
+                writer.put(bases[i].value.second.getMvalue());
+            }
+            putColumns(writer, tableau.getRows(), tableau.getColumns(), [&tableau](int i, int j) {
+                return tableau.get(i, j);
+            });
+        }
+
+        std::FILE * file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            error = "Could not create " + path;
+            return false;
+        }
+        bool written = std::fwrite(writer.data.data(), 1, writer.data.size(), file) == writer.data.size();
+        written = (std::fclose(file) == 0) && written;
+        if (!written) {
+            error = "Could not write " + path;
+        }
+        return written;
+    }
+
+    bool Snapshot::load(const std::string &path, LinearSystems::System *& system,
+                        Table *& table, std::string &error) {
+        system = nullptr;
+        table = nullptr;
+
+        MappedFile file(path);
+        if (!file.isOpen()) {
+            error = "Could not map " + path;
+            return false;
+        }
+        if (file.getSize() < sizeof(MAGIC) || std::memcmp(file.getData(), MAGIC, sizeof(MAGIC)) != 0) {
+            error = path + " is not a snapshot";
+            return false;
+        }
+
+        Cursor cursor(file.getData() + sizeof(MAGIC), file.getSize() - sizeof(MAGIC));
+        std::uint32_t version, flags, action, reserved;
+        std::int32_t restrictions, variables;
+        if (!cursor.get(version) || !cursor.get(flags) || !cursor.get(action) ||
+            !cursor.get(restrictions) || !cursor.get(variables) || !cursor.get(reserved)) {
+            error = "The snapshot is truncated";
+            return false;
+        }
+        if (version > VERSION) {
+            error = "Snapshot version " + std::to_string(version) + " is newer than this solver (" +
+                    std::to_string(VERSION) + ")";
+            return false;
+        }
+        if (restrictions <= 0 || variables <= 0 || (action != LinearSystems::MIN && action != LinearSystems::MAX)) {
+            error = "The snapshot has an invalid header";
+            return false;
+        }
+
+        // System
+        std::vector<std::int32_t> types(variables);
+        for (std::int32_t &type : types) {
+            if (!cursor.get(type)) {
+                error = "The snapshot is truncated";
+                return false;
+            }
+        }
+        cursor.align();
+        std::vector<LinearSystems::restrictionItem> objective(variables+2);
+        for (int j = 0; j < variables; ++j) {
+            objective[j].first = static_cast<LinearSystems::variableType>(types[j]);
+        }
+        double value;
+        for (int j = 0; j < 2*variables; ++j) {
+            if (!cursor.get(value)) {
+                error = "The snapshot is truncated";
+                return false;
+            }
+            if (j < variables) {
+                objective[j].second.setValue(value);
+            } else {
+                objective[j-variables].second.setMValue(value);
+            }
+        }
+        objective[variables] = LinearSystems::restrictionItem{LinearSystems::SYMBOL, Value::Number(LinearSystems::EQUAL)};
+        objective[variables+1] = LinearSystems::restrictionItem{LinearSystems::VALUE, Value::Number(0)};
+
+        // Each line starts as zeros with the type of its column
+        std::vector<LinearSystems::restrictionItem> emptyLine(variables+2);
+        for (int j = 0; j < variables; ++j) {
+            emptyLine[j] = LinearSystems::restrictionItem{objective[j].first, Value::Number(0)};
+        }
+        std::vector< std::vector<LinearSystems::restrictionItem> > lines(restrictions, emptyLine);
+
+        std::int32_t symbol;
+        for (int i = 0; i < restrictions; ++i) {
+            if (!cursor.get(symbol)) {
+                error = "The snapshot is truncated";
+                return false;
+            }
+            lines[i][variables] = LinearSystems::restrictionItem{LinearSystems::SYMBOL, Value::Number(symbol)};
+            lines[i][variables+1].first = LinearSystems::VALUE;
+        }
+        cursor.align();
+        for (int i = 0; i < 2*restrictions; ++i) {
+            if (!cursor.get(value)) {
+                error = "The snapshot is truncated";
+                return false;
+            }
+            if (i < restrictions) {
+                lines[i][variables+1].second.setValue(value);
+            } else {
+                lines[i-restrictions][variables+1].second.setMValue(value);
+            }
+        }
+        bool ok = getColumns(cursor, restrictions, variables, [&lines](int i, int j, const Value::Number &item) {
+            lines[i][j].second = item;
+        }, error);
+        if (!ok) {
+            return false;
+        }
+
+        std::vector<LinearSystems::Restriction> restrictionList;
+        restrictionList.reserve(restrictions);
+        for (int i = 0; i < restrictions; ++i) {
+            restrictionList.push_back(LinearSystems::Restriction(i+1, lines[i]));
+        }
+        LinearSystems::objType objectiveAction = static_cast<LinearSystems::objType>(action);
+        LinearSystems::Restriction objectiveRestriction(0, objective, objectiveAction);
+
+        if (!(flags & HAS_TABLE)) {
+            system = new LinearSystems::System(objectiveAction, objectiveRestriction, restrictionList);
+            return true;
+        }
+
+        // Table
+        std::int32_t rows, columns, iterations, mPlane;
+        if (!cursor.get(rows) || !cursor.get(columns) || !cursor.get(iterations) || !cursor.get(mPlane)) {
+            error = "The snapshot is truncated";
+            return false;
+        }
+        if (rows != restrictions+1 || columns != variables+2) {
+            error = "The snapshot table doesn't match its system";
+            return false;
+        }
+
+        std::vector<baseVariableItem> bases(restrictions);
+        std::int32_t number;
+        for (int i = 0; i < 2*restrictions; ++i) {
+            if (!cursor.get(number)) {
+                error = "The snapshot is truncated";
+                return false;
+            }
+            if (i < restrictions) {
+                bases[i].index = number;
+            } else {
+                bases[i-restrictions].value.first = static_cast<LinearSystems::variableType>(number);
+            }
+        }
+        cursor.align();
+        for (int i = 0; i < 2*restrictions; ++i) {
+            if (!cursor.get(value)) {
+                error = "The snapshot is truncated";
+                return false;
+            }
+            if (i < restrictions) {
+                bases[i].value.second.setValue(value);
+            } else {
+                bases[i-restrictions].value.second.setMValue(value);
+            }
+        }
+
+        Tableau tableau(rows, columns);
+        ok = getColumns(cursor, rows, columns, [&tableau](int i, int j, const Value::Number &item) {
+            tableau.set(i, j, item);
+        }, error);
+        if (!ok) {
+            return false;
+        }
+        tableau.setMPlane(mPlane != 0);
+
+        system = new LinearSystems::System(objectiveAction, objectiveRestriction, restrictionList);
+        table = new Table(system, tableau, bases, iterations);
+        return true;
+    }
+
+};
@@ -0,0 +1,55 @@
+/**
+ * @file Snapshot.hxx
+ * @brief File implemented to define the binary snapshot of a system and its table
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "../Representation/LinearSystems/System.hxx"
+#include "Table.hxx"
+
+namespace Solver {
+
+    /**
+     * Binary file with a System and, optionally, the state of the Table solving it,
+     * so a model can be solved again without parsing it
+     *
+     * Every field is little endian and fixed width, every array starts on 8 bytes:
+     *
+     *  header   magic "LSOSNAP\0", u32 version, u32 flags (1 = has table),
+     *           u32 action, i32 restrictions, i32 variables, u32 reserved
+     *  system   i32 type of each column, f64 objective values, f64 objective M values,
+     *           i32 symbol of each restriction, f64 b values, f64 b M values,
+     *           matrix by columns: i64 column starts (variables + 1), i32 lines, f64 values, f64 M values
+     *  table    i32 rows, columns, iterations, M plane in use,
+     *           base variables: i32 indexes, i32 types, f64 values, f64 M values,
+     *           tableau by columns as the matrix above
+     *
+     * Zeros are not stored, so the matrix and the table only keep their non zero cells
+     */
+    class Snapshot {
+
+        public:
+
+            static const std::uint32_t VERSION = 1;
+
+            /**
+             * Saves the system, and the table when it isn't nullptr
+             * (the table must be solving that same system)
+             */
+            static bool save(const std::string &path, LinearSystems::System * system,
+                             const Table * table, std::string &error);
+
+            /**
+             * Maps the file and rebuilds what was saved, table is nullptr if there was none
+             * False if it failed, with the reason in error
+             */
+            static bool load(const std::string &path, LinearSystems::System *& system,
+                             Table *& table, std::string &error);
+    };
+
+};
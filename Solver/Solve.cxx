@@ -0,0 +1,169 @@
+/**
+ * @file Solve.cxx
+ * @brief File implemented to implement the solver as a library, no console involved
+ * @version 0.1
+ *
+ */
+
+#include "Solve.hxx"
+#include "DualSimplex.hxx"
+#include "Presolve.hxx"
+#include "Revised.hxx"
+#include "../Representation/LinearSystems/SparseSystem.hxx"
+
+namespace Solver {
+
+    namespace {
+
+        // Same loop as Simplex::solverMain, stopping at the first optimal solution
+        status solveTable(Table * table, int &iterations) {
+            if (!table->isPrimalFeasible()) {
+                DualSimplex dual(table);
+                status dualStatus = WORK;
+                while (dualStatus == WORK) {
+                    dualStatus = dual.iterate();
+                }
+                iterations += dual.getIterations();
+                if (dualStatus == NON_VIABLE) {
+                    return NON_VIABLE;
+                }
+            }
+            while (true) {
+                table->calculateCjZj();
+                status solutionStatus = table->evaluateCjZj();
+                if (solutionStatus != WORK) {
+                    return solutionStatus;
+                }
+                status thetaStatus = table->calculateTheta();
+                if (thetaStatus == NO_FRONTIER || thetaStatus == CYCLIC) {
+                    return thetaStatus;
+                }
+                ++iterations;
+                table->updateBaseVariables();
+                table->executeIterationChange();
+            }
+        }
+
+        // Values of the system variables, empty if it didn't get to an optimal solution
+        std::vector<double> solveEngine(LinearSystems::System * system, const solveOptions &options,
+                                        solveResult &result) {
+            std::vector<double> values;
+            if (options.engine == REVISED) {
+                Revised * revised = new Revised(new LinearSystems::SparseSystem(system));
+                revised->setPricing(options.pricing);
+                while (result.solution == WORK) {
+                    result.solution = revised->iterate();
+                    if (result.solution == WORK) {
+                        ++result.iterations;
+                    }
+                }
+                if (revised->isSingular()) {
+                    result.error = "singular basis found while refactorizing";
+                }
+                result.iterations += revised->getRecoveryIterations();
+                result.perturbed = revised->wasPerturbed();
+                if (result.isOptimal()) {
+                    values = revised->getValues();
+                }
+                delete revised->getModel();
+                delete revised;
+                return values;
+            }
+
+            Table * table = new Table(system, options.engine == TWO_PHASE, options.scaled);
+            table->setThreadCount(options.threads);
+            table->setPricing(options.pricing);
+            if (!options.basis.empty() && options.engine == TABLEAU) {
+                std::string error;
+                result.warmStarted = table->importBasis(options.basis, error);
+            }
+            result.solution = solveTable(table, result.iterations);
+            result.iterations += table->getRecoveryIterations();
+            result.perturbed = table->wasPerturbed();
+            if (result.isOptimal()) {
+                values = table->getValues();
+                const baseVariableItem * bases = table->getBaseVariables();
+                for (int i = 0; i < table->getTable().getRows()-1 && options.engine == TABLEAU; ++i) {
+                    result.basis.push_back(bases[i].index-1);
+                }
+            }
+            delete table;
+            return values;
+        }
+
+    };
+
+    solveResult solve(LinearSystems::System * system, const solveOptions &options) {
+        solveResult result;
+        if (options.scaled && options.engine == REVISED) {
+            result.error = "scaling is only for the table engines";
+            return result;
+        }
+        result.isMinimum = system->getAction() == LinearSystems::MIN;
+        if (options.engine == REVISED || options.presolve) {
+            // Only the table engines keep the bounds out of the restrictions
+            if (system->getObjective()->hasNegativeLowerBounds()) {
+                result.error = "negative lower bounds are only for the table engines, without presolve";
+                return result;
+            }
+            system->boundsToRestrictions();
+        }
+
+        // Costs before any slack is added (a MIN objective is kept negated)
+        int variables = system->getNumberOfVariables();
+        std::vector<double> costs(variables);
+        for (int j = 0; j < variables; ++j) {
+            costs[j] = system->getObjective()->getRestriction()[j].second.getValue();
+        }
+
+        std::vector<double> values;
+        if (options.presolve) {
+            Presolve presolve(system);
+            result.solution = presolve.run();
+            if (result.solution == WORK) {
+                LinearSystems::System * reduced = presolve.getReduced();
+                values = solveEngine(reduced, options, result);
+                delete reduced;
+            }
+            if (result.isOptimal()) {
+                values = presolve.postsolve(values);
+            }
+        } else {
+            values = solveEngine(system, options, result);
+        }
+
+        if (result.isOptimal()) {
+            values.resize(variables);
+            double total = 0;
+            for (int j = 0; j < variables; ++j) {
+                total += costs[j]*values[j];
+            }
+            result.objective = result.isMinimum ? -total : total;
+            result.values = values;
+        }
+        return result;
+    }
+
+    solveResult solve(Readers::ModelBuilder &model, const solveOptions &options) {
+        solveResult result;
+        LinearSystems::System * system = model.build(result.error);
+        if (system == nullptr) {
+            return result;
+        }
+        result = solve(system, options);
+        delete system;
+        return result;
+    }
+
+    solveResult solve(const std::string &path, const solveOptions &options) {
+        solveResult result;
+        LinearSystems::System * system = Readers::readModel(path, Readers::formatFromPath(path), result.error);
+        if (system == nullptr) {
+            return result;
+        }
+        result = solve(system, options);
+        delete system;
+        return result;
+    }
+
+};
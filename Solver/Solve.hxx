@@ -0,0 +1,72 @@
+/**
+ * @file Solve.hxx
+ * @brief File implemented to define the solver as a library, no console involved
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../Representation/LinearSystems/System.hxx"
+#include "../Representation/Readers/Reader.hxx"
+#include "Table.hxx"
+#include "Pricing.hxx"
+
+namespace Solver {
+
+    enum engineType {
+        TABLEAU,    // Full table, rewritten every iteration
+        REVISED,    // Revised simplex, only the basis is factorized
+        TWO_PHASE   // Full table of plain doubles, phase one finds a base without M
+    };
+
+    struct solveOptions {
+        engineType engine = TABLEAU;
+        pricingRule pricing = DANTZIG;
+        int threads = 1;            // Threads of each iteration, table engines only
+        bool scaled = false;        // See Scaling, table engines only
+        bool presolve = false;      // See Presolve
+        std::vector<int> basis;     // Starts from it (see Basis), TABLEAU only, the usual one if it can't
+    };
+
+    struct solveResult {
+        status solution = WORK;     // DONE or ALTERNATED_OPTIMAL once it's optimal
+        std::string error;          // Why it couldn't solve it, solution stays WORK unless it stopped midway
+        bool isMinimum = false;
+        double objective = 0;       // In the sense of the model (C for MIN, Z for MAX)
+        std::vector<double> values; // One per variable of the model, empty unless it's optimal
+        int iterations = 0;
+        bool perturbed = false;     // See AntiCycling
+        bool warmStarted = false;   // Started from options.basis
+        std::vector<int> basis;     // Column of each base variable once it's optimal, TABLEAU only
+
+        bool isOptimal() const { return solution == DONE || solution == ALTERNATED_OPTIMAL; }
+    };
+
+    /**
+     * What Simplex does, without the menu, stdin, stdout or clearing the screen:
+     *
+     *  Readers::ModelBuilder model;
+     *  model.setAction(LinearSystems::MAX);
+     *  int x = model.getVariable("x"), y = model.getVariable("y");
+     *  model.addObjective(x, 3);
+     *  model.addObjective(y, 5);
+     *  int r = model.addRestriction("r", LinearSystems::LOWER_EQUAL);
+     *  model.addCoefficient(r, x, 3);
+     *  model.addCoefficient(r, y, 2);
+     *  model.setRightSide(r, 18);
+     *  Solver::solveResult result = Solver::solve(model);
+     *
+     * The system gets the slack and artificial columns (and the scaling), it's still the caller's
+     */
+    solveResult solve(LinearSystems::System * system, const solveOptions &options = solveOptions());
+
+    // Builds the system, solves it and deletes it
+    solveResult solve(Readers::ModelBuilder &model, const solveOptions &options = solveOptions());
+
+    // Reads the model file (.lp or .mps), solves it and deletes it
+    solveResult solve(const std::string &path, const solveOptions &options = solveOptions());
+
+};
@@ -12,35 +12,125 @@
 #include "../Representation/LinearSystems/Restriction.hxx"
 #include "../Representation/Values/Number.hxx"
 #include "Table.hxx"
+#include "DualSimplex.hxx"
+#include "Kernels.hxx"
 #include <limits.h>
 #include <iostream>
 #include <string>
-#include <set>
+#include <algorithm>
+#include <cmath>
 
 namespace Solver {
 
-    Table::Table(LinearSystems::System * toSolveSystem) : systemToSolve(toSolveSystem) {
+    std::string to_string(status value) {
+        switch (value) {
+            case WORK: return "WORK";
+            case DONE: return "DONE";
+            case NO_FRONTIER: return "NO_FRONTIER";
+            case NON_VIABLE: return "NON_VIABLE";
+            case DEGENERATED: return "DEGENERATED";
+            case ALTERNATED_OPTIMAL: return "ALTERNATED_OPTIMAL";
+            case CYCLIC: return "CYCLIC";
+        }
+        return "UNKNOWN";
+    }
+
+    Table::Table(LinearSystems::System * toSolveSystem, bool twoPhase, bool scaled) : systemToSolve(toSolveSystem) {
         results = 0;
+        iterationCount = 0;
+        recoveryIterations = 0;
         objective  = systemToSolve->getAction();
+        phase = twoPhase ? PHASE_ONE : SINGLE_PHASE;
 
         // Same number as number of restrictions
-        baseVariables = static_cast<baseVariableItem *>(
-                            malloc(sizeof(baseVariableItem)
-                                    *systemToSolve->getNumberOfRestrictions()));
+        baseVariables.resize(systemToSolve->getNumberOfRestrictions());
+
+        // Only the variables of the model, before any slack is added
+        int modelVariables = systemToSolve->getNumberOfVariables();
+        if (scaled) {
+            scaling.apply(systemToSolve);
+        }
+        flipOnly = false;
+        leavingToUpper = false;
+        applyBounds(modelVariables, scaled ? scaling.getColumnFactors() : std::vector<double>());
         
         // Checks for artificial variables,
         // insert them and adjust the restrictions
         reviewSystem();
 
+        if (scaled) {
+            // The slack of line i is r_i times the slack of the original restriction
+            const std::vector<double> &rows = scaling.getRowFactors();
+            LinearSystems::Restriction * restrictions = systemToSolve->getRestrictions();
+            columnScale = scaling.getColumnFactors();
+            for (int j = modelVariables; j < systemToSolve->getNumberOfVariables(); ++j) {
+                double factor = 1;
+                for (int i = 0; i < systemToSolve->getNumberOfRestrictions(); ++i) {
+                    const Value::Number &coefficient = restrictions[i].getRestriction()[j].second;
+                    if (coefficient.getValue() != 0 || coefficient.getMvalue() != 0) {
+                        factor = 1/rows[i];
+                        break;
+                    }
+                }
+                columnScale.push_back(factor);
+            }
+        }
+
+        if (phase == PHASE_ONE) {
+            LinearSystems::restrictionItem * objectives = systemToSolve->getObjective()->getRestriction();
+            for (int j = 0; j < systemToSolve->getNumberOfVariables(); ++j) {
+                phaseOneCosts.push_back(LinearSystems::restrictionItem(objectives[j].first,
+                                        Value::Number(isArtificial(objectives[j]) ? -1 : 0)));
+            }
+        }
+
         defineTable();
 
         // Checks for artificial variables,
         // insert them and adjust the restrictions
         decideBaseVariables();
+
+        if (phase == PHASE_ONE) {
+            for (int i = 0; i < numRes; ++i) {
+                baseVariables[i].value = phaseOneCosts[baseVariables[i].index-1];
+            }
+        }
+
+        if (!upper.empty()) {
+            // Slack and artificial columns have no bounds
+            upper.resize(numVar, RatioTest::INFINITE);
+            lowerShift.resize(numVar, 0);
+            atUpper.assign(numVar, false);
+        }
+
+        setPricing(DANTZIG);
+        pendingPerturbation = false;
+        antiCycling.start(baseColumnList());
+    }
+
+    Table::Table(LinearSystems::System * toSolveSystem, const Tableau &table,
+                 const std::vector<baseVariableItem> &bases, int iterationCount) :
+        systemToSolve(toSolveSystem), iterationCount(iterationCount), recoveryIterations(0), tableArray(table) {
+        results = 0;
+        phase = SINGLE_PHASE;
+        pivotColumn = 0;
+        pivotLine = 0;
+        objective = systemToSolve->getAction();
+        numVar = systemToSolve->getNumberOfVariables();
+        numRes = systemToSolve->getNumberOfRestrictions();
+
+        baseVariables = bases;
+        buildBasisIndex();
+        flipOnly = false;
+        leavingToUpper = false;
+
+        setPricing(DANTZIG);
+        pendingPerturbation = false;
+        antiCycling.start(baseColumnList());
     }
 
     Table::~Table() {
-        // free(baseVariables);
+
     }
 
     void Table::reviewSystem() {
@@ -50,11 +140,16 @@ namespace Solver {
         int restrictionNbr = systemToSolve->getNumberOfRestrictions();
         int variableNbr = systemToSolve->getNumberOfVariables();
 
+        // Where the columns of each restriction start among the new ones
+        std::vector<int> firstColumn(restrictionNbr);
+        std::vector<int> symbols(restrictionNbr);
         std::vector<LinearSystems::restrictionItem> artificialVariables;
         std::vector<LinearSystems::restrictionItem> results;
-        for (int i = 0; i < restrictionNbr && restrictions != nullptr; i++, restrictions++) {
-            // look for all <= or >= symbols to gather all needed artificial variables
-            results = probeRestriction(restrictions, variableNbr);
+        for (int i = 0; i < restrictionNbr && restrictions != nullptr; i++) {
+            // look for all <=, >= or = symbols to gather all needed artificial variables
+            firstColumn[i] = artificialVariables.size();
+            symbols[i] = static_cast<int>(restrictions[i].getRestrictionSymbol().getValue());
+            results = probeRestriction(&restrictions[i], variableNbr);
 
             // For all added variables
             for (LinearSystems::restrictionItem artificialVar : results) {
@@ -62,22 +157,91 @@ namespace Solver {
             }
         }
 
-        // inserts all the artificial variables into the objective
+        // The line of each one starts the base (see decideBaseVariables)
+        startingBase.assign(restrictionNbr, -1);
+        for (int i = 0; i < restrictionNbr; ++i) {
+            if (symbols[i] == LinearSystems::LOWER_EQUAL || symbols[i] == LinearSystems::EQUAL) {
+                startingBase[i] = variableNbr + firstColumn[i];
+            } else if (symbols[i] == LinearSystems::HIGHER_EQUAL) {
+                startingBase[i] = variableNbr + firstColumn[i] + 1;
+            }
+        }
 
-        objective->addArtificialVariableToObjective(artificialVariables);
+        // Value of each new column on each restriction: +1 for the slack of <= and
+        // the artificial of >= and =, -1 for the surplus of >=
+        for (int i = 0; i < restrictionNbr && restrictions != nullptr; i++) {
+            std::vector<LinearSystems::restrictionItem> columns(artificialVariables.size(),
+                LinearSystems::restrictionItem(LinearSystems::SLACK_VARIABLE, Value::Number(0)));
+            if (symbols[i] == LinearSystems::HIGHER_EQUAL) {
+                columns[firstColumn[i]].second = Value::Number(-1);
+            }
+            if (startingBase[i] != -1) {
+                columns[startingBase[i] - variableNbr].second = Value::Number(1);
+            }
+            restrictions[i].addSlackVariable(columns);
+        }
 
-        // start the loop again because we were 
-        // collecting all the artificial variables needed
-        restrictions = systemToSolve->getRestrictions();
+        // inserts all the artificial variables into the objective
+        objective->addArtificialVariableToObjective(artificialVariables);
         systemToSolve->setVariableNumber(artificialVariables.size() + systemToSolve->getNumberOfVariables());
+    }
 
-        bool isFirst = false;
+    void Table::applyBounds(int modelVariables, const std::vector<double> &columns) {
+        LinearSystems::Restriction * objectiveRestriction = systemToSolve->getObjective();
+        if (!objectiveRestriction->hasBounds()) {
+            return;
+        }
 
-        for (int i = 0; i < restrictionNbr && restrictions != nullptr; i++, restrictions++) {
-            isFirst = i == 0;
-            restrictions->addSlackVariable(artificialVariables, isFirst);
+        // In the variables of the table, x = s_j x' when scaled
+        std::vector<double> lowers(modelVariables);
+        std::vector<double> uppers(modelVariables);
+        for (int j = 0; j < modelVariables; ++j) {
+            LinearSystems::variableBounds range = objectiveRestriction->getBounds(j);
+            if (range.upper < range.lower) {
+                // Nothing fits, as restrictions the table finds it non viable
+                systemToSolve->boundsToRestrictions();
+                return;
+            }
+            double factor = columns.empty() ? 1 : columns[j];
+            lowers[j] = range.lower/factor;
+            uppers[j] = (range.upper - range.lower)/factor;
         }
+        upper = uppers;
+        lowerShift = lowers;
 
+        LinearSystems::Restriction * restrictions = systemToSolve->getRestrictions();
+        int restrictionNbr = systemToSolve->getNumberOfRestrictions();
+        rowShift.assign(restrictionNbr, 0);
+        rowSign.assign(restrictionNbr, 1);
+        for (int i = 0; i < restrictionNbr; ++i) {
+            LinearSystems::restrictionItem * items = restrictions[i].getRestriction();
+            double shift = 0;
+            for (int j = 0; j < modelVariables; ++j) {
+                shift += items[j].second.getValue()*lowerShift[j];
+            }
+            if (shift == 0) {
+                continue;
+            }
+            rowShift[i] = shift;
+            double rightSide = items[modelVariables+1].second.getValue() - shift;
+            items[modelVariables+1].second = Value::Number(rightSide);
+            if (rightSide >= 0) {
+                continue;
+            }
+
+            // -a x >= -b instead of a x <= b, so the slack (or artificial) variable starts >= 0
+            rowSign[i] = -1;
+            for (int j = 0; j < modelVariables; ++j) {
+                items[j].second = items[j].second*-1;
+            }
+            items[modelVariables+1].second = Value::Number(-rightSide);
+            int symbol = static_cast<int>(items[modelVariables].second.getValue());
+            int turned = symbol == LinearSystems::LOWER_EQUAL ? LinearSystems::HIGHER_EQUAL :
+                         symbol == LinearSystems::HIGHER_EQUAL ? LinearSystems::LOWER_EQUAL :
+                         symbol == LinearSystems::LOWER ? LinearSystems::HIGHER :
+                         symbol == LinearSystems::HIGHER ? LinearSystems::LOWER : symbol;
+            items[modelVariables].second = Value::Number(turned);
+        }
     }
 
     std::vector<LinearSystems::restrictionItem> Table::probeRestriction(LinearSystems::Restriction * restriction, int variableNbr) {
@@ -89,25 +253,25 @@ namespace Solver {
         std::vector<LinearSystems::restrictionItem> result;
         int varNbr = restriction->getVariableNumber();
 
-        std::string restrictionSymbol = 
-            LinearSystems::symbolMap[restriction->getRestrictionSymbol().getValue()];
+        int restrictionSymbol = static_cast<int>(restriction->getRestrictionSymbol().getValue());
 
         // What do we do with < and >?
-        bool needsToBeAdjusted =   ((restrictionSymbol == LinearSystems::symbolMap[LinearSystems::symbolEnum::LOWER_EQUAL])||
-                                    (restrictionSymbol == LinearSystems::symbolMap[LinearSystems::symbolEnum::HIGHER_EQUAL]));
+        bool needsToBeAdjusted =   (restrictionSymbol == LinearSystems::symbolEnum::LOWER_EQUAL ||
+                                    restrictionSymbol == LinearSystems::symbolEnum::HIGHER_EQUAL ||
+                                    restrictionSymbol == LinearSystems::symbolEnum::EQUAL);
         if (!needsToBeAdjusted) {
             return result;
         }
 
-        // Adjusting
-        LinearSystems::restrictionItem * restrictionData = restriction->getRestriction();
-
-        // We want to have only
-        Value::Number valueX(0, 0);
-        result.push_back(LinearSystems::restrictionItem(
-                LinearSystems::variableType::SLACK_VARIABLE, valueX));
+        // Slack of <=, surplus of >=
+        if (restrictionSymbol != LinearSystems::symbolEnum::EQUAL) {
+            Value::Number valueX(0, 0);
+            result.push_back(LinearSystems::restrictionItem(
+                    LinearSystems::variableType::SLACK_VARIABLE, valueX));
+        }
 
-        bool addM = restrictionSymbol == LinearSystems::symbolMap[LinearSystems::symbolEnum::HIGHER_EQUAL];
+        // >= and = have no column that can start the base at b >= 0, an artificial one does
+        bool addM = restrictionSymbol != LinearSystems::symbolEnum::LOWER_EQUAL;
         if (addM) {
             Value::Number valueM(0, 1);
             result.push_back(LinearSystems::restrictionItem(
@@ -121,108 +285,50 @@ namespace Solver {
         LinearSystems::restrictionItem *  objectiveItem = systemToSolve->getObjective()->getRestriction();
         numRes = systemToSolve->getNumberOfRestrictions();
         numVar = systemToSolve->getNumberOfVariables();
-        int repetition = 0;
-        bool lookForM = true;
 
-        std::set<int> insertedBase;
         /**
-         * All base variables must be set, the order to prioritize is:
-         * 1 - M values
-         * 2 - values without M
-         * 
-         * We must make sure that the base variable match the line where it is 1
-         * with it's column
+         * Each line starts with its own column (see reviewSystem): the slack of <=,
+         * the artificial of >= and =, 1 on that line and 0 on the others.
+         * A line without one (< or >) takes the first column still free
          */
-
-        bool alreadyIn, hasMvalue, isNaturalVariable, lookForSlack, lookForNonSlack;
-
+        std::vector<bool> taken(numVar, false);
         for (int i = 0; i < numRes; ++i) {
-            /**
-             * Look for each M value or values without M on the next
-             */
-            for (int j = 0; j < numVar; ++j) {
-                // If we are looking for M values (first loop)
-                alreadyIn  = insertedBase.find(j) != insertedBase.end();
-                hasMvalue = objectiveItem[j].second.getMvalue();
-                if (alreadyIn) {
-                    continue;
-                }
-
-                if (lookForM && hasMvalue) {
-                    insertedBase.insert(j);
-                    baseVariables[i].value.second = objectiveItem[j].second;
-                    baseVariables[i].index = j+1;
-                    break;
-                } // if (lookForM && hasMvalue)
-
-                isNaturalVariable = objectiveItem[j].first == LinearSystems::VALUE;
-                lookForSlack = (!lookForM) && !isNaturalVariable;
-                lookForNonSlack = ((!lookForM) && isNaturalVariable) && repetition > 1;
-
-                // If we already looked for M (M) AND its (not) a non-slack (N)
-                // OR
-                // we already looked for M (M) AND its a non-slack AND (N) we look for a non-slack (A)
-                // (M && !N) || ((M && N) && S)
-                // 
-                if (lookForSlack || lookForNonSlack) {
-
-                    // Last item? we cannot reach this if its a M value in the end
-                    if (j == (numVar-1)) {
-                        insertedBase.insert(j);
-                        baseVariables[i].value.second = objectiveItem[j].second;
-                        baseVariables[i].index = j+1;
-                        break;
-                    }
-
-                    // Check if this doesn't belong to an M value
-                    bool hasNextM = objectiveItem[j+1].second.getMvalue();
-                    if (hasNextM) {
-                        continue;
-                    }
-
-                    insertedBase.insert(j);
-                    baseVariables[i].value.second = objectiveItem[j].second;
-                    baseVariables[i].index = j+1;
-                    break;
+            if (startingBase[i] != -1) {
+                taken[startingBase[i]] = true;
+            }
+        }
+        for (int i = 0; i < numRes; ++i) {
+            int column = startingBase[i];
+            for (int j = 0; j < numVar && column == -1; ++j) {
+                if (!taken[j]) {
+                    column = j;
+                    taken[j] = true;
                 }
-
-            } // for (int j = numVar-1;
-            // The number of base variables must match the number of the current restriction + 1
-            if (insertedBase.size() != (i+1)) {
-                --i;
-                lookForM = false;
-                ++repetition;
-                continue;
             }
-            repetition = 0;
+            baseVariables[i].value = objectiveItem[column];
+            baseVariables[i].index = column+1;
         }
 
-        /**
-         * We must organize the variables in a proper order
-         * according to the values in their columns
-        */
-       // Same number as number of restrictions
-        baseVariableItem * tempBaseVariables = static_cast<baseVariableItem *>(
-                            malloc(sizeof(baseVariableItem)
-                                    *systemToSolve->getNumberOfRestrictions()));
+        buildBasisIndex();
+    }
 
-        int candidate = 0;
+    void Table::buildBasisIndex() {
+        basisLine.assign(numVar, -1);
         for (int i = 0; i < numRes; ++i) {
-            for (int j = 0; j < numVar; ++j) {
-                if (!isBaseVariable(j)) { // Not base, don't care
-                    continue;
-                } else if (tableArray[i][j] == 0) {
-                    continue; // Ignore, base variable shouldnt be on the line with zero to itself
-                } else if (tableArray[i][j] == 1 && !isAlreadyInList(j, tempBaseVariables)) {
-                    candidate = j+1; // Lets have this as a candidate
-                }
+            int column = baseVariables[i].index-1;
+            if (column >= 0 && column < numVar) {
+                basisLine[column] = i;
             }
-            tempBaseVariables[i].index = candidate; 
-            tempBaseVariables[i].value = objectiveItem[candidate-1];
         }
 
-        free(baseVariables);
-        baseVariables = tempBaseVariables;
+        nonBasic.clear();
+        nonBasicPosition.assign(numVar, -1);
+        for (int j = 0; j < numVar; ++j) {
+            if (basisLine[j] == -1) {
+                nonBasicPosition[j] = nonBasic.size();
+                nonBasic.push_back(j);
+            }
+        }
     }
 
     void Table::defineTable() {
@@ -238,48 +344,41 @@ namespace Solver {
         numRes = systemToSolve->getNumberOfRestrictions();
 
         LinearSystems::Restriction * restriction = systemToSolve->getRestrictions();
-        
-        std::vector<Value::Number> toInsert;
-        toInsert.reserve(numRes+2);
+
+        // One block for everything, restrictions + (Cj - Zj), variables + b + theta
+        tableArray = Tableau(numRes+1, numVar+2, phase == SINGLE_PHASE);
 
         // Build the restriction lines
         for (int i = 0;  i < numRes; ++i) {
-            toInsert.clear();
             LinearSystems::restrictionItem * restrictionIt =  restriction[i].getRestriction();
-            for (int j = 0;  j <= numVar; ++j) {
-                if (restrictionIt[j].first == LinearSystems::SYMBOL) {
-                    toInsert.push_back(restrictionIt[j+1].second);
-                    continue; // Avoid symbol
-                }
-                if (j == numVar) {
-                    toInsert.push_back(restrictionIt[j].second);
-                    // Add default theta value (0)
-                    toInsert.push_back(Value::Number(0,0));
-                    continue;
-                } else if (restrictionIt[j].second.getMvalue()) { // Turn M value into normal value
-                    toInsert.push_back(Value::Number(restrictionIt[j].second.getMvalue()));
-                    continue;
+            for (int j = 0;  j < numVar; ++j) {
+                if (restrictionIt[j].second.getMvalue()) { // Turn M value into normal value
+                    tableArray.set(i, j, Value::Number(restrictionIt[j].second.getMvalue()));
                 } else {
-                    toInsert.push_back(restrictionIt[j].second);   
+                    tableArray.set(i, j, restrictionIt[j].second);
                 }
-
             } // for (int j = 0
-            tableArray.push_back(toInsert);
+            // Skip the symbol, b is right after it
+            tableArray.set(i, numVar, restrictionIt[numVar+1].second);
+            // Add default theta value (0)
+            tableArray.set(i, numVar+1, Value::Number(0,0));
         } // for (int i = 0
 
-        toInsert.clear();
-        // Empty (Cj - Zj)
-        for (int j = 0;  j <= numVar; ++j) {
-            toInsert.push_back(Value::Number(0,0));
-        }
-        tableArray.push_back(toInsert);
+        // (Cj - Zj) starts empty, the allocation is already zeroed
+
+        // M values were turned into normal values, so usually there is no M plane left
+        tableArray.reviewMPlane();
     }
     
     std::string Table::to_string() {
+        return to_string(tableArray, baseColumnList());
+    }
+
+    std::string Table::to_string(const Tableau &table, const std::vector<int> &base) {
 
         std::string output;
 
-        LinearSystems::restrictionItem * objective = systemToSolve->getObjective()->getRestriction();
+        LinearSystems::restrictionItem * objective = costs();
         output = printSizing("| Base");
 
         for (int i = 0;  i < numVar; ++i) {
@@ -302,11 +401,11 @@ namespace Solver {
                     // Base variable: value itself (ie. 2 - 3*M) and them
                     // index of the variable (ie. x8)
                     // We would have for example: (2-3*M)*x8
-                    output += printSizing("|" + baseVariables[i].value.second.to_string() +
-                            "*x"  + std::to_string(baseVariables[i].index));
+                    output += printSizing("|" + objective[base[i]].second.to_string() +
+                            "*x"  + std::to_string(base[i]+1));
                 } // if (j == 0)
                 // Include a Number into the output, we don't want M as it isn't supposed to appear here
-                output += printSizing("|"+tableArray[i][j].to_string());
+                output += printSizing("|"+table.get(i, j).to_string());
             } // for (int j = 0;  j <= numVar+1; ++j)
             output += "\n";
         } // for (int i = 0;  i <= numRes; ++i)
@@ -314,7 +413,7 @@ namespace Solver {
         // Print (Cj - Zj)
         output += printSizing("|Cj - Zj");
         for (int j = 0;  j <= numVar; ++j) {
-            output += printSizing("|"+ tableArray[numRes][j].to_string());
+            output += printSizing("|"+ table.get(numRes, j).to_string());
         }
         output += printSizing("|");
         output += "\n";
@@ -341,44 +440,19 @@ namespace Solver {
     }
 
     bool Table::isBaseVariable(int index) {
-        for (int i = 0; i < numRes; ++i) {
-            if (baseVariables[i].index == (index+1)) {
-                return true;
-            }
-        }
-        return false;
-    }
-
-    Value::Number Table::getFirstNonBase() {
-        for (int i = 0; i < numVar; ++i) {
-            if (!isBaseVariable(i)) {
-                return tableArray[numRes][i];
-            }  
-        }
-        return Value::Number(0);
+        return basisLine[index] != -1;
     }
 
-    int Table::getFirstNonColumn() {
-        for (int i = 0; i < numVar; ++i) {
-            if (!isBaseVariable(i)) {
-                return i;
-            }  
-        }
-        return 0;
-    }
-
-    bool Table::isAlreadyInList(int index, baseVariableItem * givenList) {
-        for (int i = 0; i < numRes; ++i) {
-            if (givenList[i].index == (index+1)) {
-                return true;
-            }
-        }
-        return false;
+    bool Table::isArtificial(const LinearSystems::restrictionItem &item) {
+        return item.first == LinearSystems::SLACK_VARIABLE && item.second.getMvalue() != 0;
     }
 
-    bool Table::hasSlackVariable() {
+    bool Table::hasArtificialVariable() {
+        // At 0 they do no harm
+        LinearSystems::restrictionItem * objectives = systemToSolve->getObjective()->getRestriction();
         for (int i = 0; i < numRes; ++i) {
-            if (baseVariables[i].value.first == LinearSystems::SLACK_VARIABLE) {
+            if (isArtificial(objectives[baseVariables[i].index-1]) &&
+                tableArray.valueRow(i)[numVar] > ratioTest.getFeasibilityTolerance()) {
                 return true;
             }
         }
@@ -390,56 +464,154 @@ namespace Solver {
          * Get each column, 
          * multiply the values with the base on each line
          */
-        LinearSystems::restrictionItem * objectives = systemToSolve->getObjective()->getRestriction();
+        LinearSystems::restrictionItem * objectives = costs();
 
-        Value::Number current;
-        // Each column
-        for (int j = 0; j < numVar; ++j) {
-            // Each value
-            current = Value::Number(0,0);
+        // Columns are independent, each block of columns goes to a thread
+        if (useThreads()) {
+            threadPool->parallelFor(0, numVar+1, [this, objectives](int begin, int end) {
+                calculateCjZjColumns(objectives, begin, end);
+            });
+        } else {
+            calculateCjZjColumns(objectives, 0, numVar+1);
+        }
+    }
+
+    void Table::calculateCjZjColumns(LinearSystems::restrictionItem * objectives, int begin, int end) {
+        // Zj is accumulated line by line so the table is read in memory order,
+        // every column still sums its lines in the same order
+        double * zValue = tableArray.valueRow(numRes);
+        double * zMvalue = tableArray.mRow(numRes);
+        for (int j = begin; j < end; ++j) {
+            zValue[j] = 0;
+        }
+
+        if (!tableArray.hasMValues()) {
+            // Two-phase, plain doubles all the way
             for (int i = 0; i < numRes; ++i) {
-                current += tableArray[i][j] * baseVariables[i].value.second;
+                const double * lineValue = tableArray.valueRow(i);
+                double baseValue = baseVariables[i].value.second.getValue();
+                for (int j = begin; j < end; ++j) {
+                    zValue[j] += lineValue[j] * baseValue;
+                }
             }
-            // std::cout << "Current: " << current.to_string() << std::endl;
-            tableArray[numRes][j] = objectives[j].second - current;
-        }     
-        current = Value::Number(0,0);   
+            for (int j = begin; j < end && j < numVar; ++j) {
+                zValue[j] = objectives[j].second.getValue() - zValue[j];
+                // Rounding left on a column that can't improve anything would have it enter
+                if (std::fabs(zValue[j]) < RatioTest::FEASIBILITY_TOLERANCE) {
+                    zValue[j] = 0;
+                }
+            }
+            return;
+        }
+
+        for (int j = begin; j < end; ++j) {
+            zMvalue[j] = 0;
+        }
+
+        // Once no base variable has M, and the lines have no M either,
+        // Zj has no M part and the M plane is skipped entirely
+        bool hasMPlane = tableArray.hasMPlane();
         for (int i = 0; i < numRes; ++i) {
-            current += tableArray[i][numVar] * baseVariables[i].value.second;
+            const double * lineValue = tableArray.valueRow(i);
+            const double * lineMvalue = tableArray.mRow(i);
+            double baseValue = baseVariables[i].value.second.getValue();
+            double baseMvalue = baseVariables[i].value.second.getMvalue();
+
+            for (int j = begin; j < end; ++j) {
+                zValue[j] += lineValue[j] * baseValue;
+            }
+            if (hasMPlane) {
+                for (int j = begin; j < end; ++j) {
+                    zMvalue[j] += lineMvalue[j] * baseValue + lineValue[j] * baseMvalue;
+                }
+            } else if (baseMvalue != 0) {
+                for (int j = begin; j < end; ++j) {
+                    zMvalue[j] += lineValue[j] * baseMvalue;
+                }
+            }
+        }
+        // Each column, b keeps just Zj (the objective value)
+        for (int j = begin; j < end && j < numVar; ++j) {
+            zValue[j] = objectives[j].second.getValue() - zValue[j];
+            zMvalue[j] = objectives[j].second.getMvalue() - zMvalue[j];
+        }
+        // An artificial left on a redundant line leaves rounding on M, which would outweigh any value
+        for (int j = begin; j < end; ++j) {
+            if (std::fabs(zMvalue[j]) < RatioTest::FEASIBILITY_TOLERANCE) {
+                zMvalue[j] = 0;
+            }
+            if (j < numVar && std::fabs(zValue[j]) < RatioTest::FEASIBILITY_TOLERANCE) {
+                zValue[j] = 0;
+            }
         }
-        tableArray[numRes][numVar] = current;
     }
 
     status Table::evaluateCjZj() {
-        pivotColumn = 0;
-        Value::Number current = getFirstNonBase();
-        pivotColumn = getFirstNonColumn();
+        // Only non base columns can enter, the base ones are 0 anyway
+        int chosen = pricing->choose(*this, nonBasic);
+        if (chosen != -1) {
+            pivotColumn = chosen;
+            return WORK;
+        }
 
-        // Each column
-        for (int j = 0; j < numVar; ++j) {
-            // Keep track of highest column
-            // We don't need to check the zeroes that the base variables generate
-            if (isBaseVariable(j)) {
-                // std::cout   << "Skiping j: " << j << std::endl 
-                //             << "With value: " << tableArray[numRes][j].to_string() << std::endl;
-                continue;
+        if (!perturbation.empty()) {
+            // Optimal for the perturbed system, back to the real b. The base values move with it and
+            // some may leave their bounds, the base is still dual feasible so the dual simplex fixes them
+            removePerturbation();
+            if (!isPrimalFeasible()) {
+                DualSimplex dual(this);
+                status recovered = WORK;
+                while (recovered == WORK) {
+                    recovered = dual.iterate();
+                }
+                recoveryIterations += dual.getIterations();
+                if (recovered == NON_VIABLE) {
+                    return NON_VIABLE;
+                }
+                // Its bases went by without the anti cycling seeing them
+                antiCycling.start(baseColumnList());
             }
-            // std::cout   << "Did not skip j: " << j << std::endl 
-            //             << "With value: " << tableArray[numRes][j].to_string() << std::endl;
-            if (tableArray[numRes][j] > current) { 
-                current = tableArray[numRes][j];
+            calculateCjZj();
+            chosen = pricing->choose(*this, nonBasic);
+            if (chosen != -1) {
+                pivotColumn = chosen;
+                return WORK;
+            }
+        }
+
+        if (phase == PHASE_ONE) {
+            if (!endPhaseOne()) {
+                return NON_VIABLE;
+            }
+            calculateCjZj();
+            chosen = pricing->choose(*this, nonBasic);
+            if (chosen != -1) {
+                pivotColumn = chosen;
+                return WORK;
+            }
+        }
+
+        // Nothing improves, the highest one tells how it ended
+        pivotColumn = 0;
+        Value::Number current(0);
+        bool first = true;
+
+        for (int j : nonBasic) {
+            Value::Number value = reducedCost(j);
+            // Highest value, the lowest column among the same values (same as going through all columns)
+            if (first || value > current || (!(current > value) && j < pivotColumn)) {
+                current = value;
                 // Saves the pivot column for further calculations
-                // std::cout << "Changing pivot" << std::endl;
                 pivotColumn = j;
-            }   
-            // std::cout << "Printing current " << current.to_string() << std::endl;
+                first = false;
+            }
         }
 
         // std::cout << "Pivot column: " << pivotColumn+1 << std::endl;
         Value::Number zero = Value::Number(0,0);
         // std::cout << "Current: " << current.to_string() << std::endl;
         // std::cout << "zero: " << zero.to_string() << std::endl;
-        bool hasSlack = hasSlackVariable();
+        bool hasSlack = hasArtificialVariable();
         bool isDone = (current < zero) || (current == zero);
         if (isDone && hasSlack) {
             return NON_VIABLE;
@@ -454,52 +626,75 @@ namespace Solver {
     }
 
     status Table::calculateTheta() {
-        // std::cout << "pivot column is " << pivotColumn+1 << std::endl;
-        // For each line calculate theta
-        for (int i = 0; i < numRes; ++i) {
-            tableArray[i][numVar+1] = tableArray[i][numVar] / tableArray[i][pivotColumn];
-        }
-
-        pivotLine = 0;
-        Value::Number current = tableArray[0][numVar+1];
-        Value::Number higher = tableArray[0][numVar+1];
-        // Each column
-
-        // Checks which is lower
+        // Only the lines the pivot column can empty have a theta
+        thetaColumn.resize(numRes);
+        thetaValues.resize(numRes);
         for (int i = 0; i < numRes; ++i) {
-            // Keep track of lower column
-
-            if (current > tableArray[i][numVar+1]) {
-                current = tableArray[i][numVar+1];
-                // Saves the pivot column for further calculations
-                pivotLine = i;
+            const double * line = tableArray.valueRow(i);
+            thetaColumn[i] = line[pivotColumn];
+            thetaValues[i] = line[numVar];
+            Value::Number theta(0);
+            if (thetaColumn[i] > ratioTest.getPivotTolerance()) {
+                theta = Value::Number(thetaValues[i]/thetaColumn[i]);
             }
+            tableArray.set(i, numVar+1, theta);
+        }
 
-            if (!(higher > tableArray[i][numVar+1] || higher == tableArray[i][numVar+1])) {
-                // Keep track of no frontier systems
-                higher = tableArray[i][numVar+1];
+        ratioStep step;
+        if (upper.empty()) {
+            step = antiCycling.isActive() ?
+                   ratioTest.chooseLowestIndex(thetaColumn, thetaValues, baseColumnList()) :
+                   ratioTest.choose(thetaColumn, thetaValues);
+        } else {
+            // From its upper bound the entering variable goes down, so its column works the other way around
+            double direction = isAtUpper(pivotColumn) ? -1 : 1;
+            thetaBounded.resize(numRes);
+            thetaUpper.resize(numRes);
+            for (int i = 0; i < numRes; ++i) {
+                thetaBounded[i] = direction*thetaColumn[i];
+                thetaUpper[i] = upper[baseVariables[i].index-1];
             }
-
+            step = antiCycling.isActive() ?
+                   ratioTest.chooseLowestIndex(thetaBounded, thetaValues, baseColumnList(), thetaUpper, upper[pivotColumn]) :
+                   ratioTest.choose(thetaBounded, thetaValues, thetaUpper, upper[pivotColumn]);
         }
-        int same = 0;
-        for (int i = 0; i < numRes; ++i) {
-            if (current == tableArray[i][numVar+1]) {
-                ++same;
-            }
+        if (step.boundFlip) {
+            // Gets to its other bound before any base variable leaves, no pivot
+            flipOnly = true;
+            return WORK;
         }
-
-        // std::cout << "Pivot Line: " << pivotLine+1 << std::endl;
-        // std::cout << "Pivot Element: " << current.to_string() << std::endl;
-        // std::cout << "Pivot (Cj - Zj): " << tableArray[numRes][pivotColumn].to_string() << std::endl;
-        if (same>1) {
-            return DEGENERATED;
-        } else if (higher < Value::Number(0,0) || higher == Value::Number(0,0) || higher == INT_MAX) {
+        if (step.line == -1) {
+            // Nothing limits the entering variable
             return NO_FRONTIER;
         }
-
+        pivotLine = step.line;
+        leavingToUpper = step.toUpper;
+
+        // A degenerate pivot (theta 0) is still a pivot, the basis changes and it goes on,
+        // unless it's going around in circles
+        cycleEvent event = antiCycling.record(pivotColumn, baseVariables[pivotLine].index-1, step.degenerate);
+        if (event == REPEATED_BASIS && antiCycling.isActive()) {
+            return CYCLIC;
+        } else if (event != NO_CYCLE && !antiCycling.isActive()) {
+            // Done right after this pivot
+            pendingPerturbation = true;
+        }
         return WORK;
     }
 
+    void Table::setPivot(int line, int column, bool toUpper) {
+        pivotLine = line;
+        pivotColumn = column;
+        leavingToUpper = toUpper;
+        // What calculateTheta would have left, the perturbation follows this column. A perturbation
+        // the last calculateTheta asked for was for a pivot that isn't going to happen
+        thetaColumn.resize(numRes);
+        for (int i = 0; i < numRes; ++i) {
+            thetaColumn[i] = tableArray.valueRow(i)[column];
+        }
+        pendingPerturbation = false;
+    }
+
     void Table::updateBaseVariables() {
         /**
          * Now we have the pivot column and line
@@ -508,18 +703,35 @@ namespace Solver {
          * 
          * Now we do the exchange
         */
-        LinearSystems::restrictionItem * objectives = systemToSolve->getObjective()->getRestriction();
+        LinearSystems::restrictionItem * objectives = costs();
         // std::cout << "Old base variable that will be gone: " << baseVariables[pivotLine].value.second.to_string() << std::endl;
     
-        baseVariables[pivotLine] = baseVariableItem{objectives[pivotColumn], pivotColumn+1};
+        // The leaving column takes the place of the entering one on the non base list
+        int leaving = flipOnly ? -1 : baseVariables[pivotLine].index-1;
+        leavingColumn = leaving;
+
+        // The table is still the one before the pivot, as the pricing needs it
+        if (leaving >= 0 && leaving < numVar) {
+            pricing->update(*this, nonBasic, pivotColumn, leaving, pivotLine);
+        }
+        if (leaving >= 0 && leaving < numVar && basisLine[pivotColumn] == -1) {
+            basisLine[leaving] = -1;
+            nonBasic[nonBasicPosition[pivotColumn]] = leaving;
+            nonBasicPosition[leaving] = nonBasicPosition[pivotColumn];
+        }
+        if (!flipOnly) {
+            basisLine[pivotColumn] = pivotLine;
+            nonBasicPosition[pivotColumn] = -1;
+            baseVariables[pivotLine] = baseVariableItem{objectives[pivotColumn], pivotColumn+1};
+        }
         // std::cout << "New base variable that is here now: " << baseVariables[pivotLine].value.second.to_string() << std::endl;
         // Zero out the Theta column
         for (int i = 0; i < numRes; ++i) {
-            tableArray[i][numVar+1] = Value::Number(0);
+            tableArray.set(i, numVar+1, Value::Number(0));
         }
         // Zero out the Cj - Zj column
         for (int i = 0; i <= numVar; ++i) {
-            tableArray[numRes][i] = Value::Number(0);
+            tableArray.set(numRes, i, Value::Number(0));
         }
     }
 
@@ -530,11 +742,24 @@ namespace Solver {
          * We need however, to 0 out the column of the new base variable on all the other ones
         */
 
-        Value::Number pivotElement = tableArray[pivotLine][pivotColumn];
+        if (flipOnly) {
+            // Same base, only the entering variable moved to its other bound
+            flipBound(pivotColumn);
+            flipOnly = false;
+            ++iterationCount;
+            return;
+        }
+
+        bool hasMPlane = tableArray.hasMPlane();
+        double * pivotValue = tableArray.valueRow(pivotLine);
+        double * pivotMvalue = tableArray.mRow(pivotLine);
+        // No scenarios where it divides by M
+        double pivotElement = pivotValue[pivotColumn];
 
         // Pivot line is easy, yay
-        for (int i = 0; i <= numVar; ++i) {
-            tableArray[pivotLine][i] = tableArray[pivotLine][i]/pivotElement;
+        Kernels::divide(pivotValue, pivotElement, numVar+1);
+        if (hasMPlane) {
+            Kernels::divide(pivotMvalue, pivotElement, numVar+1);
         }
 
         // We will use the created line as reference for the next lines
@@ -542,20 +767,539 @@ namespace Solver {
         // tableArray[nonPivotLine][pivotColumn] -A*tableArray[pivotLine][pivotColumn]
         // Become zero
 
-        // Non pivot lines is a bit harder
-        // Pivot line is easy, yay
+        // Non pivot lines is a bit harder, but each one only depends on the pivot line,
+        // so each block of lines goes to a thread
+        if (useThreads()) {
+            threadPool->parallelFor(0, numRes, [this](int begin, int end) {
+                eliminateLines(begin, end);
+            });
+        } else {
+            eliminateLines(0, numRes);
+        }
+
+        // b was pivoted as if the entering variable left 0 and the leaving one went to 0
+        if (!atUpper.empty()) {
+            if (atUpper[pivotColumn]) {
+                tableArray.valueRow(pivotLine)[numVar] += upper[pivotColumn];
+                atUpper[pivotColumn] = false;
+            }
+            if (leavingToUpper && leavingColumn >= 0) {
+                atUpper[leavingColumn] = false;
+                flipBound(leavingColumn);
+            }
+        }
+        leavingToUpper = false;
+
+        // Same change on what the perturbation added to b
+        if (!perturbation.empty()) {
+            double moved = perturbation[pivotLine]/thetaColumn[pivotLine];
+            for (int i = 0; i < numRes; ++i) {
+                perturbation[i] -= thetaColumn[i]*moved;
+            }
+            perturbation[pivotLine] = moved;
+        }
+        if (pendingPerturbation) {
+            perturb();
+        }
+        ++iterationCount;
+    }
+
+    LinearSystems::restrictionItem * Table::costs() {
+        if (phase == PHASE_ONE) {
+            return phaseOneCosts.data();
+        }
+        return systemToSolve->getObjective()->getRestriction();
+    }
+
+    bool Table::endPhaseOne() {
+        // Zj of b is minus the sum of the artificial variables
+        if (tableArray.valueRow(numRes)[numVar] < -ratioTest.getFeasibilityTolerance()) {
+            return false;
+        }
+
+        LinearSystems::restrictionItem * objectives = systemToSolve->getObjective()->getRestriction();
+        std::vector<bool> artificial(numVar);
+        for (int j = 0; j < numVar; ++j) {
+            artificial[j] = isArtificial(objectives[j]);
+        }
+
+        // Artificial variables left in the base are 0, any other column of their line can take it
+        for (int i = 0; i < numRes; ++i) {
+            int column = baseVariables[i].index-1;
+            if (!artificial[column]) {
+                continue;
+            }
+            const double * line = tableArray.valueRow(i);
+            int entering = -1;
+            for (int j = 0; j < numVar && entering == -1; ++j) {
+                if (!artificial[j] && basisLine[j] == -1 && std::fabs(line[j]) > ratioTest.getPivotTolerance()) {
+                    entering = j;
+                }
+            }
+            if (entering == -1) {
+                // Redundant line, the artificial variable stays there at 0 and costs nothing
+                artificial[column] = false;
+                objectives[column].second = Value::Number(0);
+                continue;
+            }
+
+            thetaColumn.resize(numRes);
+            for (int k = 0; k < numRes; ++k) {
+                thetaColumn[k] = tableArray.valueRow(k)[entering];
+            }
+            pivotColumn = entering;
+            pivotLine = i;
+            updateBaseVariables();
+            executeIterationChange();
+        }
+
+        // Same table without the artificial columns
+        std::vector<int> newColumn(numVar, -1);
+        int kept = 0;
+        for (int j = 0; j < numVar; ++j) {
+            if (!artificial[j]) {
+                newColumn[j] = kept++;
+            }
+        }
+        Tableau reduced(numRes+1, kept+2, false);
+        for (int i = 0; i < numRes; ++i) {
+            const double * line = tableArray.valueRow(i);
+            double * newLine = reduced.valueRow(i);
+            for (int j = 0; j < numVar; ++j) {
+                if (newColumn[j] != -1) {
+                    newLine[newColumn[j]] = line[j];
+                }
+            }
+            newLine[kept] = line[numVar];
+        }
+        tableArray = std::move(reduced);
+
+        if (!columnScale.empty()) {
+            for (int j = 0; j < numVar; ++j) {
+                if (newColumn[j] != -1) {
+                    columnScale[newColumn[j]] = columnScale[j];
+                }
+            }
+            columnScale.resize(kept);
+        }
+        if (!upper.empty()) {
+            for (int j = 0; j < numVar; ++j) {
+                if (newColumn[j] != -1) {
+                    upper[newColumn[j]] = upper[j];
+                    lowerShift[newColumn[j]] = lowerShift[j];
+                    atUpper[newColumn[j]] = atUpper[j];
+                }
+            }
+            upper.resize(kept);
+            lowerShift.resize(kept);
+            atUpper.resize(kept);
+        }
+
+        LinearSystems::Restriction * restrictions = systemToSolve->getRestrictions();
+        for (int i = 0; i < numRes; ++i) {
+            restrictions[i].removeVariables(artificial);
+        }
+        systemToSolve->getObjective()->removeVariables(artificial);
+        systemToSolve->setVariableNumber(kept);
+        numVar = kept;
+        phase = PHASE_TWO;
+        phaseOneCosts.clear();
+
+        objectives = systemToSolve->getObjective()->getRestriction();
+        for (int i = 0; i < numRes; ++i) {
+            int column = newColumn[baseVariables[i].index-1];
+            baseVariables[i] = baseVariableItem{objectives[column], column+1};
+        }
+        buildBasisIndex();
+
+        pricing = Pricing::create(pricing->getRule());
+        pricing->start(*this, numVar);
+        antiCycling.start(baseColumnList());
+        return true;
+    }
+
+    bool Table::changeRightSide(int restriction, double value) {
+        LinearSystems::restrictionItem * items = systemToSolve->getRestrictions()[restriction].getRestriction();
+
+        // A column that was +-e_restriction, it's now +-B^-1 e_restriction
+        int unit = -1;
+        double sign = 0;
+        for (int j = 0; j < numVar && unit == -1; ++j) {
+            const Value::Number &coefficient = items[j].second;
+            double entry = coefficient.getMvalue() ? coefficient.getMvalue() : coefficient.getValue();
+            if (entry != 1 && entry != -1) {
+                continue;
+            }
+            bool alone = true;
+            for (int i = 0; i < numRes && alone; ++i) {
+                const Value::Number &other = systemToSolve->getRestrictions()[i].getRestriction()[j].second;
+                alone = i == restriction || (other.getValue() == 0 && other.getMvalue() == 0);
+            }
+            if (alone) {
+                unit = j;
+                sign = entry;
+            }
+        }
+        if (unit == -1) {
+            return false;
+        }
+
+        // Cut lines are added already scaled
+        const std::vector<double> &rows = scaling.getRowFactors();
+        if (restriction < static_cast<int>(rows.size())) {
+            value *= rows[restriction];
+        }
+        // Same as applyBounds did to it
+        if (restriction < static_cast<int>(rowShift.size())) {
+            value = (value - rowShift[restriction])*rowSign[restriction];
+        }
+
+        double change = value - items[numVar+1].second.getValue();
+        for (int i = 0; i < numRes; ++i) {
+            double * line = tableArray.valueRow(i);
+            line[numVar] += change*sign*line[unit];
+        }
+        items[numVar+1].second = Value::Number(value);
+        return true;
+    }
+
+    bool Table::addCut(const std::vector<double> &coefficients, LinearSystems::symbolEnum symbol, double rightSide) {
+        if (symbol != LinearSystems::LOWER_EQUAL && symbol != LinearSystems::LOWER &&
+            symbol != LinearSystems::HIGHER_EQUAL && symbol != LinearSystems::HIGHER) {
+            return false;
+        }
+        // Always as <=
+        double sign = (symbol == LinearSystems::HIGHER_EQUAL || symbol == LinearSystems::HIGHER) ? -1 : 1;
+        std::vector<double> cut(numVar, 0);
+        for (int j = 0; j < numVar && j < static_cast<int>(coefficients.size()); ++j) {
+            cut[j] = sign*coefficients[j]*unscale(j);
+        }
+        double cutValue = sign*rightSide;
+        for (int j = 0; j < numVar && !upper.empty(); ++j) {
+            cutValue -= cut[j]*lowerShift[j];
+        }
+
+        // In terms of the current base, each base variable takes its line out of the cut
+        std::vector<double> newLine(cut);
+        double newValue = cutValue;
+        for (int j = 0; j < numVar && !upper.empty(); ++j) {
+            // Non base variables held at their upper bound
+            if (isAtUpper(j)) {
+                newValue -= cut[j]*upper[j];
+            }
+        }
+        for (int i = 0; i < numRes; ++i) {
+            double factor = cut[baseVariables[i].index-1];
+            if (factor == 0) {
+                continue;
+            }
+            const double * line = tableArray.valueRow(i);
+            for (int j = 0; j < numVar; ++j) {
+                newLine[j] -= factor*line[j];
+            }
+            newValue -= factor*line[numVar];
+        }
+
+        // One more line and one more column (the slack of the cut) before b and theta
+        Tableau bigger(numRes+2, numVar+3, tableArray.hasMValues());
+        for (int i = 0; i < numRes; ++i) {
+            const double * line = tableArray.valueRow(i);
+            double * biggerLine = bigger.valueRow(i);
+            std::copy(line, line + numVar, biggerLine);
+            biggerLine[numVar+1] = line[numVar];
+            if (tableArray.hasMPlane()) {
+                std::copy(tableArray.mRow(i), tableArray.mRow(i) + numVar, bigger.mRow(i));
+                bigger.mRow(i)[numVar+1] = tableArray.mRow(i)[numVar];
+            }
+        }
+        double * cutLine = bigger.valueRow(numRes);
+        std::copy(newLine.begin(), newLine.end(), cutLine);
+        cutLine[numVar] = 1;
+        cutLine[numVar+1] = newValue;
+        bigger.setMPlane(tableArray.hasMPlane());
+        tableArray = std::move(bigger);
+
+        // Same in the system: a slack column everywhere and the cut as a new restriction
+        LinearSystems::restrictionItem slack(LinearSystems::SLACK_VARIABLE, Value::Number(0));
+        LinearSystems::Restriction * restrictions = systemToSolve->getRestrictions();
+        for (int i = 0; i < numRes; ++i) {
+            restrictions[i].appendVariable(slack);
+        }
+        systemToSolve->getObjective()->appendVariable(slack);
+
+        LinearSystems::restrictionItem * objectives = systemToSolve->getObjective()->getRestriction();
+        std::vector<LinearSystems::restrictionItem> items;
+        for (int j = 0; j < numVar; ++j) {
+            items.push_back(LinearSystems::restrictionItem(objectives[j].first, Value::Number(cut[j])));
+        }
+        items.push_back(LinearSystems::restrictionItem(LinearSystems::SLACK_VARIABLE, Value::Number(1)));
+        items.push_back(LinearSystems::restrictionItem(LinearSystems::SYMBOL, Value::Number(LinearSystems::EQUAL)));
+        items.push_back(LinearSystems::restrictionItem(LinearSystems::VALUE, Value::Number(cutValue)));
+        systemToSolve->addRestriction(LinearSystems::Restriction(numRes+1, items));
+        systemToSolve->setVariableNumber(numVar+1);
+        if (!columnScale.empty()) {
+            columnScale.push_back(1);
+        }
+        if (!upper.empty()) {
+            upper.push_back(RatioTest::INFINITE);
+            lowerShift.push_back(0);
+            atUpper.push_back(false);
+        }
+
+        // The slack is the base variable of the new line
+        baseVariables.push_back(baseVariableItem{objectives[numVar], numVar+1});
+
+        ++numVar;
+        ++numRes;
+        buildBasisIndex();
+        pricing = Pricing::create(pricing->getRule());
+        pricing->start(*this, numVar);
+        antiCycling.start(baseColumnList());
+        return true;
+    }
+
+    bool Table::importBasis(const std::vector<int> &columns, std::string &error) {
+        error.clear();
+        if (static_cast<int>(columns.size()) != numRes) {
+            error = "the basis has " + std::to_string(columns.size()) + " columns for " +
+                    std::to_string(numRes) + " restrictions";
+            return false;
+        }
+        std::vector<bool> wanted(numVar, false);
+        for (int column : columns) {
+            if (column < 0 || column >= numVar) {
+                error = "there is no x" + std::to_string(column+1);
+                return false;
+            } else if (wanted[column]) {
+                error = "x" + std::to_string(column+1) + " is twice in the basis";
+                return false;
+            }
+            wanted[column] = true;
+        }
+
+        // To go back to if it can't be used
+        Tableau startTable = tableArray;
+        std::vector<baseVariableItem> startBases(baseVariables);
+        std::vector<bool> startAtUpper(atUpper);
+        int startIterations = iterationCount;
+
+        thetaColumn.resize(numRes);
+        for (int column : columns) {
+            if (isBaseVariable(column)) {
+                continue;
+            }
+            // Only lines whose base variable leaves anyway, the largest pivot among them
+            int line = -1;
+            double best = ratioTest.getPivotTolerance();
+            for (int i = 0; i < numRes; ++i) {
+                double value = std::fabs(tableArray.valueRow(i)[column]);
+                if (!wanted[baseVariables[i].index-1] && value > best) {
+                    best = value;
+                    line = i;
+                }
+            }
+            if (line == -1) {
+                error = "the basis is singular, x" + std::to_string(column+1) + " can't enter";
+                break;
+            }
+            for (int i = 0; i < numRes; ++i) {
+                thetaColumn[i] = tableArray.valueRow(i)[column];
+            }
+            pivotColumn = column;
+            pivotLine = line;
+            updateBaseVariables();
+            executeIterationChange();
+        }
+
+        if (error.empty() && !isPrimalFeasible()) {
+            // Only the dual simplex can start from here, as long as nothing improves
+            calculateCjZj();
+            for (int j : nonBasic) {
+                // A boxed column improving from 0 doesn't from its upper bound
+                if (!upper.empty() && upper[j] != RatioTest::INFINITE && isImproving(reducedCost(j))) {
+                    flipBound(j);
+                }
+            }
+            for (int j : nonBasic) {
+                if (isImproving(reducedCost(j))) {
+                    error = "the basis is neither primal nor dual feasible";
+                    break;
+                }
+            }
+            for (int j = 0; j <= numVar; ++j) {
+                tableArray.set(numRes, j, Value::Number(0));
+            }
+        }
+
+        if (!error.empty()) {
+            tableArray = std::move(startTable);
+            baseVariables = startBases;
+            atUpper = startAtUpper;
+            buildBasisIndex();
+        }
+        // Setting the base up isn't an iteration
+        iterationCount = startIterations;
+        pricing = Pricing::create(pricing->getRule());
+        pricing->start(*this, numVar);
+        antiCycling.start(baseColumnList());
+        return error.empty();
+    }
+
+    bool Table::isPrimalFeasible() {
+        for (int i = 0; i < numRes; ++i) {
+            double value = tableArray.valueRow(i)[numVar];
+            if (value < -ratioTest.getFeasibilityTolerance()) {
+                return false;
+            } else if (!upper.empty() && value > upper[baseVariables[i].index-1] + ratioTest.getFeasibilityTolerance()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Table::flipBound(int column) {
+        // b - a_j u_j going up, b + a_j u_j going back down
+        double move = atUpper[column] ? upper[column] : -upper[column];
+        for (int i = 0; i < numRes; ++i) {
+            double * line = tableArray.valueRow(i);
+            line[numVar] += move*line[column];
+        }
+        atUpper[column] = !atUpper[column];
+    }
+
+    Value::Number Table::objectiveValue() {
+        Value::Number total = tableArray.get(numRes, numVar);
+        LinearSystems::restrictionItem * objectives = costs();
+        for (int j = 0; j < numVar && !upper.empty(); ++j) {
+            double value = lowerShift[j] + (isAtUpper(j) ? upper[j] : 0);
+            if (value != 0) {
+                total = total + objectives[j].second*value;
+            }
+        }
+        return total;
+    }
+
+    std::vector<int> Table::baseColumnList() {
+        std::vector<int> columns(numRes);
+        for (int i = 0; i < numRes; ++i) {
+            columns[i] = baseVariables[i].index-1;
+        }
+        return columns;
+    }
+
+    void Table::perturb() {
+        std::vector<double> values(numRes);
+        for (int i = 0; i < numRes; ++i) {
+            values[i] = tableArray.valueRow(i)[numVar];
+        }
+        perturbation = antiCycling.perturbation(values);
         for (int i = 0; i < numRes; ++i) {
+            tableArray.valueRow(i)[numVar] += perturbation[i];
+        }
+
+        antiCycling.setActive(true);
+        antiCycling.start(baseColumnList());
+        pricing = Pricing::create(BLAND);
+        pricing->start(*this, numVar);
+        pendingPerturbation = false;
+    }
+
+    void Table::removePerturbation() {
+        for (int i = 0; i < numRes; ++i) {
+            double &value = tableArray.valueRow(i)[numVar];
+            value -= perturbation[i];
+            if (value < 0 && value > -AntiCycling::REMOVAL_TOLERANCE) {
+                value = 0;
+            }
+        }
+        perturbation.clear();
+    }
+
+    void Table::eliminateLines(int begin, int end) {
+        bool hasMPlane = tableArray.hasMPlane();
+        const double * pivotValue = tableArray.valueRow(pivotLine);
+        const double * pivotMvalue = tableArray.mRow(pivotLine);
+
+        for (int i = begin; i < end; ++i) {
             if (i == pivotLine) continue;
+            double * lineValue = tableArray.valueRow(i);
+            double * lineMvalue = tableArray.mRow(i);
             // Value of the non pivot line on the pivot column, so we can always remember it ahead
-            Value::Number pivotColumnEqualizer = tableArray[i][pivotColumn];
-            for (int j = 0; j <= numVar; ++j) {
-                tableArray[i][j] = tableArray[i][j] - tableArray[pivotLine][j]*pivotColumnEqualizer;
+            double equalizerValue = lineValue[pivotColumn];
+            double equalizerMvalue = hasMPlane ? lineMvalue[pivotColumn] : 0;
+            // Same as line - pivotLine*equalizer on Numbers, one plane at a time
+            if (hasMPlane) {
+                Kernels::multiplySubtractPair(lineMvalue, pivotMvalue, equalizerValue,
+                                              pivotValue, equalizerMvalue, numVar+1);
             }
+            Kernels::multiplySubtract(lineValue, pivotValue, equalizerValue, numVar+1);
+        }
+    }
+
+    void Table::setThreadCount(int threads) {
+        if (threads <= 1) {
+            threadPool.reset();
+            return;
+        }
+        threadPool = std::make_shared<ThreadPool>(threads);
+    }
+
+    int Table::getThreadCount() {
+        return threadPool ? threadPool->getThreadCount() : 1;
+    }
+
+    void Table::setPricing(pricingRule rule) {
+        pricing = Pricing::create(rule);
+        pricing->start(*this, numVar);
+    }
+
+    Value::Number Table::reducedCost(int column) const {
+        // At its upper bound a variable can only go down, improving the other way around
+        Value::Number cost = tableArray.get(numRes, column);
+        return isAtUpper(column) ? cost*-1 : cost;
+    }
+
+    bool Table::isImproving(const Value::Number &cost) const {
+        // Same test evaluateCjZj ends with
+        return !(cost < Value::Number(0,0)) && !(cost == Value::Number(0,0));
+    }
+
+    bool Table::isHigherCost(const Value::Number &first, const Value::Number &second) const {
+        return first > second;
+    }
+
+    double Table::columnNorm(int column) const {
+        // The restriction lines have no M part
+        double norm = 0;
+        for (int i = 0; i < numRes; ++i) {
+            double value = tableArray.valueRow(i)[column];
+            norm += value*value;
         }
+        return norm;
+    }
 
-        // Discover which is the value to divide all by
+    void Table::pivotRow(int line, std::vector<double> &row) const {
+        const double * value = tableArray.valueRow(line);
+        row.assign(value, value + numVar);
+    }
 
+    void Table::columnDots(int column, std::vector<double> &dots) const {
+        dots.assign(numVar, 0);
+        for (int i = 0; i < numRes; ++i) {
+            const double * value = tableArray.valueRow(i);
+            double factor = value[column];
+            if (factor == 0) {
+                continue;
+            }
+            for (int j = 0; j < numVar; ++j) {
+                dots[j] += factor*value[j];
+            }
+        }
+    }
 
+    bool Table::useThreads() {
+        // Small tables are faster on a single thread than waking up the others
+        return threadPool && (static_cast<long>(numRes) * (numVar+1)) >= PARALLEL_THRESHOLD;
     }
 
     std::string Table::getResults(bool isAlternated) {
@@ -571,21 +1315,42 @@ namespace Solver {
             output = "Optimal solution found\n";
         }
         if (systemToSolve->getAction() == LinearSystems::MIN) {
-            output += "C: " + (tableArray[numRes][numVar]*-1).to_string();
+            output += "C: " + (objectiveValue()*-1).to_string();
         } else {
-            output += "Z: " + (tableArray[numRes][numVar]).to_string();
+            output += "Z: " + objectiveValue().to_string();
         }
 
         output += "\n";
 
         // Get the result obtained in the variables
+        std::vector<double> values = getValues();
         for (int i = 0; i < numRes; ++i) {
             output += "x"+std::to_string(baseVariables[i].index);
-            output += " = " + tableArray[i][numVar].to_string();
+            output += " = " + Value::Number(values[baseVariables[i].index-1]).to_string();
             output += "\n";
         }
+        // Out of the base, but held at a bound other than 0
+        for (int j : nonBasic) {
+            if (values[j] != 0) {
+                output += "x" + std::to_string(j+1) + " = " + Value::Number(values[j]).to_string() + "\n";
+            }
+        }
         output += "\n";
         return output;
     }
 
+    std::vector<double> Table::getValues() {
+        std::vector<double> values(numVar, 0);
+        for (int i = 0; i < numRes; ++i) {
+            values[baseVariables[i].index-1] = tableArray.valueRow(i)[numVar];
+        }
+        for (int j = 0; j < numVar; ++j) {
+            if (!upper.empty()) {
+                values[j] += lowerShift[j] + (isAtUpper(j) ? upper[j] : 0);
+            }
+            values[j] *= unscale(j);
+        }
+        return values;
+    }
+
 };
\ No newline at end of file
@@ -13,6 +13,14 @@
 
 #include "../Representation/LinearSystems/System.hxx"
 #include "../Representation/LinearSystems/Restriction.hxx"
+#include "Tableau.hxx"
+#include "Pricing.hxx"
+#include "RatioTest.hxx"
+#include "AntiCycling.hxx"
+#include "Scaling.hxx"
+#include "../Helpers/ThreadPool.hxx"
+#include <memory>
+#include <vector>
 
 /**
  * A table resembles this:
@@ -54,19 +62,48 @@ namespace Solver {
         CYCLIC,                 // When the resolution goes into loop
     };
 
-    class Table {
+    // Name of the status ("DONE", "NON_VIABLE"...)
+    std::string to_string(status value);
+
+    enum phaseType {
+        SINGLE_PHASE,   // Big-M, artificial variables cost M
+        PHASE_ONE,      // Two-phase, minimizing the sum of the artificial variables
+        PHASE_TWO       // Two-phase, artificial columns dropped and back to the real objective
+    };
+
+    class Table : private PricingSource {
 
         public:
 
-            Table(LinearSystems::System * toSolveSystem);
+            /**
+             * twoPhase: instead of carrying M through the table, phase one minimizes the
+             * sum of the artificial variables and phase two drops their columns.
+             * The table then has no M plane at all, only doubles
+             * scaled: the restrictions are scaled first (see Scaling), the results are
+             * given back in the variables of the system as it was
+             */
+            Table(LinearSystems::System * toSolveSystem, bool twoPhase = false, bool scaled = false);
+
+            /**
+             * Rebuilds a table from a saved state (see Snapshot), the system
+             * must be the reviewed one, with its slack and artificial variables
+             */
+            Table(LinearSystems::System * toSolveSystem, const Tableau &table,
+                  const std::vector<baseVariableItem> &bases, int iterationCount);
 
             ~Table();
 
             std::string to_string();
 
+            /**
+             * Same as to_string, for another table of this one (see History::rebuild)
+             * base: the column of the base variable of each line
+             */
+            std::string to_string(const Tableau &table, const std::vector<int> &base);
+
             int returnTable();
 
-            std::vector< std::vector<Value::Number> > getTable() { return tableArray; }
+            const Tableau & getTable() const { return tableArray; }
 
             void calculateCjZj();
 
@@ -80,12 +117,121 @@ namespace Solver {
 
             std::string getResults(bool isAlternated = false);
 
+            // Value of each variable (the column order), 0 for the non base ones
+            std::vector<double> getValues();
+
             LinearSystems::System * getSystemToSolve() { return systemToSolve; }
 
+            // One per restriction, in the order of the lines
+            const baseVariableItem * getBaseVariables() const { return baseVariables.data(); }
+
+            // Pivots done on this table
+            int getIterationCount() const { return iterationCount; }
+
+            // Dual simplex pivots evaluateCjZj did to get back to b >= 0 after the perturbation
+            int getRecoveryIterations() const { return recoveryIterations; }
+
+            phaseType getPhase() const { return phase; }
+
+            // Non base columns, in no particular order
+            const std::vector<int> & getNonBasic() const { return nonBasic; }
+
+            bool isArtificialColumn(int column) { return isArtificial(systemToSolve->getObjective()->getRestriction()[column]); }
+
+            /**
+             * Line and column of the next pivot, for engines choosing them on their own (dual simplex)
+             * toUpper: the variable leaving stops at its upper bound instead of 0
+             */
+            void setPivot(int line, int column, bool toUpper = false);
+
+            // The ones calculateTheta (or setPivot) chose for the next pivot
+            int getPivotLine() const { return pivotLine; }
+            int getPivotColumn() const { return pivotColumn; }
+
+            // The next iteration only moves the entering variable to its other bound
+            bool isBoundFlip() const { return flipOnly; }
+
+            // Costs in use, the system objective or the phase one ones
+            const LinearSystems::restrictionItem * getCosts() { return costs(); }
+
+            // b of the (Cj - Zj) line plus what the bounds add (variables out of the base not at 0)
+            Value::Number getObjectiveValue() { return objectiveValue(); }
+
+            /**
+             * Upper bound of each column, INFINITE for the ones without one. The lower bounds are
+             * moved to 0 (see applyBounds) and the scaling applied. Empty if no variable has bounds
+             */
+            const std::vector<double> & getUpper() const { return upper; }
+
+            // Non base column at its upper bound instead of 0
+            bool isAtUpper(int column) const { return !atUpper.empty() && atUpper[column]; }
+
+            // A non base column with an upper bound goes to its other bound, the base values follow
+            void flipBound(int column);
+
+            /**
+             * Changes b of a restriction (0 based) on a solved table, through the column of its
+             * slack (or artificial) variable, the base stays and may no longer be feasible
+             * False if the restriction has no such column
+             */
+            bool changeRightSide(int restriction, double value);
+
+            /**
+             * Adds a restriction (<= or >=) over the current variables, coefficients beyond
+             * the ones given are 0. Its slack variable enters the base on the new line,
+             * negative if the current solution breaks it. False for any other symbol
+             */
+            bool addCut(const std::vector<double> &coefficients, LinearSystems::symbolEnum symbol, double rightSide);
+
+            /**
+             * Starts from a saved basis (see Basis) instead of the one decideBaseVariables chose:
+             * pivots each of those columns into the base, the largest pivot of the lines still free
+             * first. A base the primal can't start from is kept only if no column improves, so the
+             * dual simplex can take it back to b >= 0. Otherwise (or if it's singular) the table goes
+             * back to the usual starting base and it returns false, with the reason in error
+             */
+            bool importBasis(const std::vector<int> &columns, std::string &error);
+
+            // Every base value is >= 0 (with the ratio test tolerance)
+            bool isPrimalFeasible();
+
+            /**
+             * Splits the pivot and (Cj - Zj) across threads, 1 (default) keeps it serial
+             * The results are the same regardless of the number of threads
+             */
+            void setThreadCount(int threads);
+
+            int getThreadCount();
+
+            // How the entering column is chosen, Dantzig by default
+            void setPricing(pricingRule rule);
+
+            pricingRule getPricing() const { return pricing->getRule(); }
+
+            // Factors used on the system, not applied unless the table was built scaled
+            const Scaling & getScaling() const { return scaling; }
+
+            // Whether it had to perturb the system and move to Bland's rule (see AntiCycling)
+            bool wasPerturbed() const { return antiCycling.isActive(); }
+
+            // Minimum number of cells in the table for it to be worth using the threads
+            static const long PARALLEL_THRESHOLD = 16384;
+
         private:
 
             void reviewSystem();
 
+            /**
+             * Bounded simplex: the bounds of the variables (see Restriction::setBounds) take no line,
+             * a non base variable sits at 0 or at its upper bound. Lower bounds are moved to 0 first
+             * (x = l + x'), the restrictions that ends up with b < 0 are turned around
+             * columns: the scaling factors of the variables, empty if not scaled
+             */
+            void applyBounds(int modelVariables, const std::vector<double> &columns);
+
+            // b of the (Cj - Zj) line plus what the bounds add (variables out of the base not at 0)
+            Value::Number objectiveValue();
+
             std::vector<LinearSystems::restrictionItem> probeRestriction(LinearSystems::Restriction * restriction, int variableNbr);
 
             void decideBaseVariables();
@@ -94,15 +240,58 @@ namespace Solver {
 
             static std::string printSizing(std::string toSizeInput);
 
+            // O(1), through basisLine
             bool isBaseVariable(int index);
 
-            Value::Number getFirstNonBase();
+            // basisLine and the non base list from baseVariables
+            void buildBasisIndex();
 
-            int getFirstNonColumn();
+            // Costs in use, the system objective or the phase one ones
+            LinearSystems::restrictionItem * costs();
 
-            bool isAlreadyInList(int index, baseVariableItem * givenList);
+            /**
+             * Phase one is optimal: false if the artificial variables can't all be 0, otherwise
+             * takes them out of the base, drops their columns (table and system) and
+             * goes on with the real objective
+             */
+            bool endPhaseOne();
 
-            bool hasSlackVariable();
+            // Artificial variables are the slack ones costing M
+            static bool isArtificial(const LinearSystems::restrictionItem &item);
+
+            // Column of the base variable of each line
+            std::vector<int> baseColumnList();
+
+            // Perturbs b and moves to Bland's rule, once cycling or stalling is detected
+            void perturb();
+
+            // Takes the perturbation out of b, once it's optimal, rounding left below 0 goes to 0
+            void removePerturbation();
+
+            // Whether an artificial variable is still in the base with a positive value
+            bool hasArtificialVariable();
+
+            // What a column of the scaled table is multiplied by to be back in the system variables
+            double unscale(int column) const { return columnScale.empty() ? 1 : columnScale[column]; }
+
+            void calculateCjZjColumns(LinearSystems::restrictionItem * objectives, int begin, int end);
+
+            void eliminateLines(int begin, int end);
+
+            bool useThreads();
+
+            // What the pricing rules read from the table (see Pricing.hxx)
+            Value::Number reducedCost(int column) const;
+
+            bool isImproving(const Value::Number &cost) const;
+
+            bool isHigherCost(const Value::Number &first, const Value::Number &second) const;
+
+            double columnNorm(int column) const;
+
+            void pivotRow(int line, std::vector<double> &row) const;
+
+            void columnDots(int column, std::vector<double> &dots) const;
 
             LinearSystems::System * systemToSolve;
 
@@ -111,13 +300,72 @@ namespace Solver {
             int pivotColumn;
             int pivotLine;
             int results;
+            int iterationCount;
+            int recoveryIterations;
 
             LinearSystems::objectiveType objective;
 
-            baseVariableItem * baseVariables;
+            phaseType phase;
+
+            // -1 for each artificial variable, 0 for the others
+            std::vector<LinearSystems::restrictionItem> phaseOneCosts;
+
+            std::vector<baseVariableItem> baseVariables;
+
+            // Column each line starts the base with, -1 for the ones reviewSystem gave none
+            std::vector<int> startingBase;
+
+            // Line of each base column (-1 for non base ones), kept by updateBaseVariables
+            std::vector<int> basisLine;
+
+            // Non base columns, in no particular order, and where each one is on that list
+            std::vector<int> nonBasic;
+            std::vector<int> nonBasicPosition;
             
-            std::vector< std::vector<Value::Number> > tableArray;
+            Tableau tableArray;
+
+            // Shared by the copies of the table, the history keeps none (see History)
+            std::shared_ptr<ThreadPool> threadPool;
+
+            // Also shared by the copies, only the table being solved uses it
+            std::shared_ptr<Pricing> pricing;
+
+            RatioTest ratioTest;
+
+            // Pivot column and b of the restriction lines, as the ratio test takes them
+            std::vector<double> thetaColumn;
+            std::vector<double> thetaValues;
+
+            AntiCycling antiCycling;
+            bool pendingPerturbation;
+
+            // What the perturbation added to b, pivoted along with the table
+            std::vector<double> perturbation;
+
+            Scaling scaling;
+
+            // s_j of the variables, 1/r_i of the slack (or artificial) variables of line i. Empty if not scaled
+            std::vector<double> columnScale;
+
+            // Bounds of each column (see applyBounds), all empty when no variable has them
+            std::vector<double> upper;
+            std::vector<double> lowerShift;
+            std::vector<bool> atUpper;
+
+            // What the lower bounds took out of b of each restriction, and -1 for the ones turned around
+            std::vector<double> rowShift;
+            std::vector<double> rowSign;
+
+            // The ratio test found the entering variable reaches its own bound first, there is no pivot
+            bool flipOnly;
+
+            // The leaving variable stops at its upper bound, and its column
+            bool leavingToUpper;
+            int leavingColumn;
 
+            // Pivot column going the way the entering variable moves, and the bounds of each line
+            std::vector<double> thetaBounded;
+            std::vector<double> thetaUpper;
 
     };
 
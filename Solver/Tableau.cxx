@@ -0,0 +1,130 @@
+/**
+ * @file Tableau.cxx
+ * @brief File implemented to implement the dense storage of the simplex table
+ * @version 0.1
+ *
+ */
+
+#include "Tableau.hxx"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace Solver {
+
+    namespace {
+
+        // std::aligned_alloc isn't there on MSVC or MinGW, which have their own
+        double * alignedAllocate(std::size_t alignment, std::size_t size) {
+#ifdef _WIN32
+            return static_cast<double *>(_aligned_malloc(size, alignment));
+#else
+            // The size has to be a multiple of the alignment, which the stride already makes it
+            return static_cast<double *>(std::aligned_alloc(alignment, size));
+#endif
+        }
+
+        void alignedFree(double * memory) {
+#ifdef _WIN32
+            _aligned_free(memory);
+#else
+            std::free(memory);
+#endif
+        }
+
+    };
+
+    Tableau::Tableau() :
+        rows(0), columns(0), stride(0), mPlaneActive(true), withMValues(true), values(nullptr), mValues(nullptr) {
+
+    }
+
+    Tableau::Tableau(int rows, int columns, bool withMValues) :
+        rows(rows), columns(columns), mPlaneActive(withMValues), withMValues(withMValues),
+        values(nullptr), mValues(nullptr) {
+        // Pad every row up to a full cache line
+        int perLine = CACHE_LINE / sizeof(double);
+        stride = ((columns + perLine - 1) / perLine) * perLine;
+        allocate();
+    }
+
+    Tableau::Tableau(const Tableau &input) :
+        rows(input.rows), columns(input.columns), stride(input.stride),
+        mPlaneActive(input.mPlaneActive), withMValues(input.withMValues), values(nullptr), mValues(nullptr) {
+        allocate();
+        if (values != nullptr) {
+            std::memcpy(values, input.values, sizeof(double) * rows * stride);
+        }
+        if (mValues != nullptr) {
+            std::memcpy(mValues, input.mValues, sizeof(double) * rows * stride);
+        }
+    }
+
+    Tableau::Tableau(Tableau &&input) noexcept :
+        rows(input.rows), columns(input.columns), stride(input.stride),
+        mPlaneActive(input.mPlaneActive), withMValues(input.withMValues),
+        values(input.values), mValues(input.mValues) {
+        input.values = input.mValues = nullptr;
+        input.rows = input.columns = input.stride = 0;
+    }
+
+    Tableau::~Tableau() {
+        alignedFree(values);
+        alignedFree(mValues);
+    }
+
+    Tableau& Tableau::operator=(Tableau input) {
+        std::swap(rows, input.rows);
+        std::swap(columns, input.columns);
+        std::swap(stride, input.stride);
+        std::swap(mPlaneActive, input.mPlaneActive);
+        std::swap(withMValues, input.withMValues);
+        std::swap(values, input.values);
+        std::swap(mValues, input.mValues);
+        return *this;
+    }
+
+    void Tableau::reviewMPlane() {
+        if (!withMValues) {
+            mPlaneActive = false;
+            return;
+        }
+        // The last line is (Cj - Zj), its M plane is always kept
+        for (int i = 0; i < rows-1; ++i) {
+            const double * line = mRow(i);
+            for (int j = 0; j < columns; ++j) {
+                if (line[j] != 0) {
+                    mPlaneActive = true;
+                    return;
+                }
+            }
+        }
+        mPlaneActive = false;
+    }
+
+    void Tableau::allocate() {
+        std::size_t size = sizeof(double) * rows * stride;
+        if (size == 0) {
+            return;
+        }
+        values = alignedAllocate(CACHE_LINE, size);
+        if (withMValues) {
+            mValues = alignedAllocate(CACHE_LINE, size);
+        }
+        if (values == nullptr || (withMValues && mValues == nullptr)) {
+            alignedFree(values);
+            alignedFree(mValues);
+            throw std::bad_alloc();
+        }
+        std::memset(values, 0, size);
+        if (withMValues) {
+            std::memset(mValues, 0, size);
+        }
+    }
+
+};
@@ -0,0 +1,120 @@
+/**
+ * @file Tableau.hxx
+ * @brief File implemented to define the dense storage of the simplex table
+ * @version 0.1
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "../Representation/Values/Number.hxx"
+
+namespace Solver {
+
+    /**
+     * Row-major matrix of Numbers split in two planes (structure of arrays):
+     *  - one plane with the real part of every cell
+     *  - one plane with the M part of every cell
+     *
+     * Each plane is a single aligned allocation and each row starts on a cache line,
+     * the stride being the number of columns rounded up to a full cache line of doubles.
+     *
+     * Most of the table has no M part at all, so the M plane of the restriction lines
+     * can be switched off and the kernels only touch the real plane.
+     * A table built without M values (two-phase) has no M plane at all, only doubles
+     */
+    class Tableau {
+
+        public:
+
+            static const std::size_t CACHE_LINE = 64;
+
+            /**
+             * Strided view over a single column
+             */
+            class ColumnView {
+
+                public:
+
+                    ColumnView(const Tableau * table, int column) : table(table), column(column) {}
+
+                    Value::Number operator[](int i) const { return table->get(i, column); }
+
+                    int getSize() const { return table->getRows(); }
+
+                private:
+
+                    const Tableau * table;
+                    int column;
+            };
+
+            Tableau();
+
+            Tableau(int rows, int columns, bool withMValues = true);
+
+            Tableau(const Tableau &input);
+
+            Tableau(Tableau &&input) noexcept;
+
+            ~Tableau();
+
+            Tableau& operator=(Tableau input);
+
+            int getRows() const { return rows; }
+            int getColumns() const { return columns; }
+            int getStride() const { return stride; }
+
+            double * valueRow(int i) { return values + static_cast<std::size_t>(i)*stride; }
+            const double * valueRow(int i) const { return values + static_cast<std::size_t>(i)*stride; }
+
+            // nullptr when there are no M values
+            double * mRow(int i) { return mValues ? mValues + static_cast<std::size_t>(i)*stride : nullptr; }
+            const double * mRow(int i) const { return mValues ? mValues + static_cast<std::size_t>(i)*stride : nullptr; }
+
+            Value::Number get(int i, int j) const {
+                std::size_t cell = static_cast<std::size_t>(i)*stride + j;
+                return Value::Number(values[cell], mValues ? mValues[cell] : 0);
+            }
+
+            // Without M values the M part is dropped
+            void set(int i, int j, const Value::Number &input) {
+                std::size_t cell = static_cast<std::size_t>(i)*stride + j;
+                values[cell] = input.getValue();
+                if (mValues) {
+                    mValues[cell] = input.getMvalue();
+                }
+            }
+
+            ColumnView column(int j) const { return ColumnView(this, j); }
+
+            /**
+             * Whether the restriction lines (all but the last one) may have M parts,
+             * when false the kernels skip the M plane of those lines
+             */
+            bool hasMPlane() const { return mPlaneActive; }
+
+            void setMPlane(bool active) { mPlaneActive = active && withMValues; }
+
+            // Whether there is an M plane at all, even for (Cj - Zj)
+            bool hasMValues() const { return withMValues; }
+
+            // Checks the M plane of the restriction lines and switches it off when it's all zero
+            void reviewMPlane();
+
+        private:
+
+            void allocate();
+
+            int rows;
+            int columns;
+            int stride;
+
+            bool mPlaneActive;
+            bool withMValues;
+
+            double * values;
+            double * mValues;
+    };
+
+};
@@ -13,9 +13,265 @@
 #include <iostream>
 // #include "Representation/Values/Number.hxx"
 #include "Solver/Simplex.hxx"
+#include "Solver/Snapshot.hxx"
+#include "Solver/Basis.hxx"
+#include "Solver/Batch.hxx"
+#include "Solver/Server.hxx"
+#include "Helpers/Helper.hxx"
+#include "Representation/Readers/Reader.hxx"
 
-int main () {
+// Starts the table from a saved basis, the usual starting one is kept if it can't
+static void importBasis(Solver::Table * table, const std::string &path) {
+    const Solver::Tableau &tableau = table->getTable();
+    std::vector<int> columns;
+    std::string error;
+    if (!Solver::Basis::load(path, tableau.getRows()-1, tableau.getColumns()-2, columns, error) ||
+        !table->importBasis(columns, error)) {
+        std::cout << "Could not use the basis, starting from the usual one: " << error << std::endl;
+    }
+}
 
-    Solver::Simplex * simplex = new Solver::Simplex();
+int main (int argc, char ** argv) {
 
-}
\ No newline at end of file
+    int threads = 1;
+    Solver::engineType engine = Solver::TABLEAU;
+    Solver::pricingRule pricing = Solver::DANTZIG;
+    Solver::resolutionOption option = Solver::RESULT_ONLY;
+    std::string modelPath;
+    Readers::modelFormat format = Readers::UNKNOWN_FORMAT;
+    bool mapped = true;
+    std::string snapshotPath;
+    std::vector<Solver::modification> changes;
+    std::string basisInput;
+    std::string basisOutput;
+    bool presolveFirst = false;
+    bool scaled = false;
+    std::string batchPath;
+    bool batchValues = false;
+    std::string socketPath;
+    int cacheSize = 64;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument(argv[i]);
+        // -t N or --threads N: number of threads used on each iteration
+        if ((argument == "-t" || argument == "--threads") && (i+1) < argc) {
+            Helper::isAllDigits(argv[++i], threads);
+        } else if (argument == "-r" || argument == "--revised") {
+            engine = Solver::REVISED;
+        } else if (argument == "-2" || argument == "--two-phase") {
+            // Table without M, phase one looks for a base first
+            engine = Solver::TWO_PHASE;
+        } else if ((argument == "-p" || argument == "--pricing") && (i+1) < argc) {
+            // dantzig, devex, steepest or partial
+            if (!Solver::pricingFromName(argv[++i], pricing)) {
+                std::cout << "Unknown pricing rule: " << argv[i] << std::endl;
+                return 1;
+            }
+        } else if (argument == "-s" || argument == "--steps") {
+            // Only for model files, the menu asks it otherwise
+            option = Solver::FAST_ITERATIONS;
+        } else if (argument == "--fixed-mps") {
+            format = Readers::FIXED_MPS;
+        } else if (argument == "--save" && (i+1) < argc) {
+            // Binary snapshot of the model (and its first table) to solve it again later
+            snapshotPath = argv[++i];
+        } else if (argument == "--rhs" && (i+2) < argc) {
+            // --rhs R V: once solved, b of restriction R becomes V and it's solved again
+            Solver::modification change;
+            change.type = Solver::modification::RIGHT_SIDE;
+            double value;
+            Helper::isAllDigits(argv[i+1], change.line);
+            if (change.line < 1 || !Value::Number::parse(argv[i+2], value)) {
+                std::cout << "Invalid --rhs: " << argv[i+1] << " " << argv[i+2] << std::endl;
+                return 1;
+            }
+            change.line -= 1;
+            change.value = value;
+            changes.push_back(change);
+            i += 2;
+        } else if (argument == "--cut" && (i+1) < argc) {
+            // --cut "1 1 <= 5": once solved, this restriction is added and it's solved again
+            Solver::modification change;
+            if (!Solver::DualSimplex::parseCut(argv[++i], change)) {
+                std::cout << "Invalid --cut: " << argv[i] << std::endl;
+                return 1;
+            }
+            changes.push_back(change);
+        } else if (argument == "--basis" && (i+1) < argc) {
+            // Starts from the basis saved by a previous solve (--save-basis)
+            basisInput = argv[++i];
+        } else if (argument == "--save-basis" && (i+1) < argc) {
+            // Saves the final basis, for the next solve of a similar model
+            basisOutput = argv[++i];
+        } else if (argument == "--presolve") {
+            // Shrinks the system before the table is built
+            presolveFirst = true;
+        } else if (argument == "--scale") {
+            // Brings the coefficients close to 1 before the table is built
+            scaled = true;
+        } else if (argument == "--batch" && (i+1) < argc) {
+            // Every model of a directory (or listed in a file), -t of them at a time
+            batchPath = argv[++i];
+        } else if (argument == "--values") {
+            // The batch also writes the value of each variable
+            batchValues = true;
+        } else if (argument == "--serve" && (i+1) < argc) {
+            // Stays up answering requests on this Unix domain socket, -t of them at a time
+            socketPath = argv[++i];
+        } else if (argument == "--cache" && (i+1) < argc) {
+            // Parsed models the server keeps
+            Helper::isAllDigits(argv[++i], cacheSize);
+        } else if (argument == "--buffered") {
+            // Read the model through a buffer instead of mapping it
+            mapped = false;
+        } else {
+            // Anything else is the model file (.mps or .lp)
+            modelPath = argument;
+        }
+    }
+
+    if (!socketPath.empty()) {
+        Solver::solveOptions defaults;
+        defaults.engine = engine;
+        defaults.pricing = pricing;
+        Solver::Server server(socketPath, threads, cacheSize, defaults);
+        std::string error;
+        if (!server.run(error)) {
+            std::cout << "Server stopped: " << error << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    if (!batchPath.empty()) {
+        std::vector<std::string> models;
+        std::string error;
+        if (!Solver::Batch::listModels(batchPath, models, error)) {
+            std::cout << "Could not list the models: " << error << std::endl;
+            return 1;
+        }
+        Solver::Batch batch(threads, engine, pricing, batchValues);
+        return batch.run(models, std::cout) == 0 ? 0 : 1;
+    }
+
+    if (modelPath.empty()) {
+        // Each Simplex solves on construction, nothing is left to do with it after
+        Solver::Simplex(threads, engine, pricing);
+        return 0;
+    }
+
+    std::string error;
+    LinearSystems::System * system = nullptr;
+    Solver::Table * table = nullptr;
+
+    if (modelPath.size() > 5 && modelPath.compare(modelPath.size()-5, 5, ".snap") == 0) {
+        if (!Solver::Snapshot::load(modelPath, system, table, error)) {
+            std::cout << "Could not load the snapshot: " << error << std::endl;
+            return 1;
+        }
+        if (table != nullptr) {
+            // The table is ready, there is nothing left to build
+            if (presolveFirst || scaled) {
+                std::cout << "The snapshot has its table built already, --presolve and --scale "
+                          << "can't change it" << std::endl;
+                delete table;
+                delete system;
+                return 1;
+            }
+            if (!basisInput.empty()) {
+                importBasis(table, basisInput);
+            }
+            // The Simplex frees the table, the system is still ours
+            Solver::Simplex(table, option, threads, pricing, changes, basisOutput);
+            delete system;
+            return 0;
+        }
+    } else {
+        if (format == Readers::UNKNOWN_FORMAT) {
+            format = Readers::formatFromPath(modelPath);
+        }
+        system = Readers::readModel(modelPath, format, error, mapped);
+        if (system == nullptr) {
+            std::cout << "Could not load the model: " << error << std::endl;
+            return 1;
+        }
+    }
+
+    // Only the table engines keep the bounds out of the restrictions, the snapshot doesn't save them
+    if (presolveFirst || engine == Solver::REVISED || !snapshotPath.empty()) {
+        if (system->getObjective()->hasNegativeLowerBounds()) {
+            std::cout << "Negative lower bounds are only for the table engines, "
+                      << "they can't go with --presolve, --revised or --save" << std::endl;
+            return 1;
+        }
+        system->boundsToRestrictions();
+    }
+
+    // What was read, presolve solves a smaller copy of it
+    LinearSystems::System * original = system;
+    Solver::Presolve * presolve = nullptr;
+    if (presolveFirst) {
+        if (!changes.empty()) {
+            std::cout << "--rhs and --cut refer to the restrictions as typed in, they can't go with --presolve" << std::endl;
+            return 1;
+        }
+        presolve = new Solver::Presolve(system);
+        Solver::status presolveStatus = presolve->run();
+        std::cout << presolve->to_string() << std::endl;
+        if (presolveStatus == Solver::NON_VIABLE) {
+            std::cout << "The code has a non viable solution, ending the program..." << std::endl;
+            return 0;
+        } else if (presolveStatus == Solver::NO_FRONTIER) {
+            std::cout << "No frontier system detected, no solution available here" << std::endl;
+            return 0;
+        } else if (presolveStatus == Solver::DONE) {
+            // Nothing left for the table
+            std::cout << presolve->getResults(std::vector<double>()) << std::endl;
+            return 0;
+        }
+        system = presolve->getReduced();
+    }
+
+    bool warmStart = !basisInput.empty() || !basisOutput.empty();
+    if (engine == Solver::REVISED && (!changes.empty() || warmStart)) {
+        std::cout << "Changes after the solve and saved bases need the table, not the revised engine" << std::endl;
+        return 1;
+    }
+
+    if (scaled && (engine == Solver::REVISED || !snapshotPath.empty())) {
+        std::cout << "--scale is only for the table engines and the snapshot would lose its factors, "
+                  << "it can't go with --revised or --save" << std::endl;
+        return 1;
+    }
+
+    // The table engine saves the built table too, the revised one only needs the system
+    if ((!snapshotPath.empty() && engine == Solver::TABLEAU) || !changes.empty() || warmStart || scaled) {
+        table = new Solver::Table(system, engine == Solver::TWO_PHASE, scaled);
+        if (scaled) {
+            const Solver::Scaling &scaling = table->getScaling();
+            std::cout << "Scaled, spread of the coefficients from " << scaling.getSpreadBefore()
+                      << " to " << scaling.getSpreadAfter() << std::endl;
+        }
+        if (!basisInput.empty()) {
+            importBasis(table, basisInput);
+        }
+    }
+
+    Solver::Table * savedTable = engine == Solver::TABLEAU ? table : nullptr;
+    if (!snapshotPath.empty() && !Solver::Snapshot::save(snapshotPath, system, savedTable, error)) {
+        std::cout << "Could not save the snapshot: " << error << std::endl;
+    }
+
+    if (table != nullptr) {
+        // The Simplex frees the table
+        Solver::Simplex(table, option, threads, pricing, changes, basisOutput, presolve);
+    } else {
+        Solver::Simplex(system, option, threads, engine, pricing, presolve);
+    }
+
+    if (system != original) {
+        delete system;
+    }
+    delete original;
+    delete presolve;
+    return 0;
+}